@@ -0,0 +1,329 @@
+#include "Analysis.hpp"
+
+#include <algorithm> // For std::stable_sort
+#include <cstdio>    // For snprintf
+#include <thread>
+
+#include "EngineStats.hpp"
+
+using namespace std;
+
+// --- Zobrist Hashing ---
+
+namespace {
+
+const char PIECE_ORDER[] = "PNBRQKpnbrqk";
+
+uint64_t splitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+struct ZobristKeys {
+    // Indexed by the piece character itself so lookups need no search; rows
+    // for empty squares and other characters stay zero and hash to nothing
+    uint64_t piece[128][BOARD_SIZE * BOARD_SIZE] = {};
+    uint64_t blackToMove;
+
+    ZobristKeys() {
+        uint64_t seed = 0x43484553532D5A42ULL; // Fixed so hashes are stable between runs
+        for (const char* p = PIECE_ORDER; *p; ++p) for (auto& key : piece[int(*p)]) key = splitMix64(seed);
+        blackToMove = splitMix64(seed);
+    }
+
+    uint64_t at(char p, int r, int c) const { return piece[p & 0x7F][r * BOARD_SIZE + c]; }
+};
+
+const ZobristKeys& zobrist() {
+    static const ZobristKeys keys;
+    return keys;
+}
+
+} // namespace
+
+uint64_t hashPosition(const ChessGame& position) {
+    const ZobristKeys& keys = zobrist();
+    uint64_t hash = position.whiteToMove() ? 0 : keys.blackToMove;
+    for (int r = 0; r < BOARD_SIZE; ++r) {
+        for (int c = 0; c < BOARD_SIZE; ++c) {
+            hash ^= keys.at(position.getPieceAt(r, c), r, c);
+        }
+    }
+    return hash;
+}
+
+// --- Transposition Table ---
+
+namespace {
+
+// data layout: move (16) | score (16) | depth (8) | bound (8)
+uint64_t packEntry(PackedMove move, int score, int depth, TranspositionTable::Bound bound) {
+    return uint64_t(move) | (uint64_t(uint16_t(int16_t(score))) << 16) | (uint64_t(uint8_t(depth)) << 32) | (uint64_t(bound) << 40);
+}
+
+} // namespace
+
+TranspositionTable::TranspositionTable(size_t megabytes) {
+    size_t wanted = max<size_t>(1, megabytes * 1024 * 1024 / sizeof(Slot));
+    size_t count = 1;
+    while (count * 2 <= wanted) count *= 2; // Power of two so the index is a mask
+    slots.reset(new Slot[count]);
+    mask = count - 1;
+}
+
+bool TranspositionTable::probe(uint64_t key, Entry& out) const {
+    const Slot& slot = slots[key & mask];
+    uint64_t data = slot.data.load(memory_order_relaxed);
+    uint64_t check = slot.check.load(memory_order_relaxed);
+    if ((check ^ data) != key || data == 0) return false;
+    out.move = PackedMove(data & 0xFFFF);
+    out.score = int16_t(uint16_t((data >> 16) & 0xFFFF));
+    out.depth = int((data >> 32) & 0xFF);
+    out.bound = Bound((data >> 40) & 0xFF);
+    return true;
+}
+
+void TranspositionTable::store(uint64_t key, PackedMove move, int score, int depth, Bound bound) {
+    Slot& slot = slots[key & mask];
+    uint64_t data = packEntry(move, score, depth, bound);
+    slot.check.store(key ^ data, memory_order_relaxed);
+    slot.data.store(data, memory_order_relaxed);
+}
+
+void TranspositionTable::clear() {
+    for (size_t i = 0; i <= mask; ++i) {
+        slots[i].check.store(0, memory_order_relaxed);
+        slots[i].data.store(0, memory_order_relaxed);
+    }
+}
+
+// --- Search ---
+
+namespace {
+
+const int MATE_BOUND = MATE_SCORE - 1000; // Scores beyond this are mates
+
+// Mate scores are stored relative to the node so they stay valid when the
+// same position is reached at a different distance from the root.
+int scoreToTT(int score, int ply) { return score > MATE_BOUND ? score + ply : score < -MATE_BOUND ? score - ply : score; }
+int scoreFromTT(int score, int ply) { return score > MATE_BOUND ? score - ply : score < -MATE_BOUND ? score + ply : score; }
+
+bool sameMove(const Move& m, PackedMove p) { return p != 0 && packMove(m.startR, m.startC, m.endR, m.endC) == p; }
+
+// Hash move first, then the capture scores generateValidMoves already assigns
+void orderMoves(vector<Move>& moves, PackedMove ttMove) {
+    stable_sort(moves.begin(), moves.end(), [ttMove](const Move& a, const Move& b) {
+        bool aHash = sameMove(a, ttMove), bHash = sameMove(b, ttMove);
+        if (aHash != bHash) return aHash;
+        return a.score > b.score;
+    });
+}
+
+class Searcher {
+public:
+    Searcher(ChessGame& game, TranspositionTable* tt, const atomic<bool>* stop)
+        : game(game), tt(tt), stop(stop), key(hashPosition(game)) {}
+
+    // An aborted node's score is meaningless, so nothing is stored or reported once this is set
+    bool stopped() const { return stop && stop->load(memory_order_relaxed); }
+
+    // Plays / takes back a move on the board and the running hash together.
+    // unmake must get the piece make returned.
+    char make(const Move& m);
+    void unmake(const Move& m, char captured);
+
+    int negamax(int depth, int alpha, int beta, int ply, vector<Move>& pv);
+    int quiesce(int alpha, int beta);
+
+private:
+    ChessGame& game;
+    TranspositionTable* tt;
+    const atomic<bool>* stop;
+    uint64_t key;   // hashPosition(game), kept up to date move by move
+
+    // What a move changes in the hash; XOR-ing it in again takes it back out
+    uint64_t moveKey(const Move& m, char piece, char captured) const {
+        const ZobristKeys& keys = zobrist();
+        return keys.at(piece, m.startR, m.startC) ^ keys.at(piece, m.endR, m.endC)
+             ^ keys.at(captured, m.endR, m.endC) ^ keys.blackToMove;
+    }
+};
+
+char Searcher::make(const Move& m) {
+    char piece = game.getPieceAt(m.startR, m.startC);
+    char captured = game.makeSearchMove(m.startR, m.startC, m.endR, m.endC);
+    key ^= moveKey(m, piece, captured);
+    return captured;
+}
+
+void Searcher::unmake(const Move& m, char captured) {
+    game.unmakeSearchMove(m.startR, m.startC, m.endR, m.endC, captured);
+    key ^= moveKey(m, game.getPieceAt(m.startR, m.startC), captured);
+}
+
+int Searcher::negamax(int depth, int alpha, int beta, int ply, vector<Move>& pv) {
+    pv.clear();
+    if (stopped()) return 0;
+    if (depth <= 0) return quiesce(alpha, beta);
+
+    PackedMove ttMove = 0;
+    if (tt) {
+        TranspositionTable::Entry entry;
+        STATS_INC(ttProbes);
+        if (tt->probe(key, entry)) {
+            STATS_INC(ttHits);
+            ttMove = entry.move;
+            int score = scoreFromTT(entry.score, ply);
+            if (entry.depth >= depth &&
+                (entry.bound == TranspositionTable::BOUND_EXACT ||
+                 (entry.bound == TranspositionTable::BOUND_LOWER && score >= beta) ||
+                 (entry.bound == TranspositionTable::BOUND_UPPER && score <= alpha))) {
+                STATS_INC(ttCutoffs);
+                int sr, sc, er, ec;
+                unpackMove(ttMove, sr, sc, er, ec);
+                if (ttMove != 0 && game.isMoveValid(sr, sc, er, ec)) pv.push_back(Move(sr, sc, er, ec));
+                return score;
+            }
+        }
+    }
+
+    vector<Move> moves = game.generateValidMoves();
+    if (moves.empty()) return game.isKingInCheck(game.whiteToMove()) ? -MATE_SCORE + ply : 0;
+    orderMoves(moves, ttMove);
+
+    int alphaOrig = alpha;
+    int best = -INFINITE_SCORE;
+    PackedMove bestMove = 0;
+    vector<Move> childPv;
+    for (size_t i = 0; i < moves.size(); ++i) {
+        const Move& m = moves[i];
+        char captured = make(m);
+        int score = -negamax(depth - 1, -beta, -alpha, ply + 1, childPv);
+        unmake(m, captured);
+        if (stopped()) return 0;
+
+        if (score > best) {
+            best = score;
+            bestMove = packMove(m.startR, m.startC, m.endR, m.endC);
+            if (score > alpha) {
+                alpha = score;
+                pv.assign(1, m);
+                pv.insert(pv.end(), childPv.begin(), childPv.end());
+            }
+        }
+        if (alpha >= beta) {
+            STATS_INC(betaCutoffs);
+            if (i == 0) STATS_INC(firstMoveCutoffs);
+            break;
+        }
+    }
+
+    if (tt) {
+        TranspositionTable::Bound bound = best <= alphaOrig ? TranspositionTable::BOUND_UPPER
+                                        : best >= beta      ? TranspositionTable::BOUND_LOWER
+                                                            : TranspositionTable::BOUND_EXACT;
+        tt->store(key, bestMove, scoreToTT(best, ply), depth, bound);
+    }
+    return best;
+}
+
+// Follows captures only, so the static evaluation is never taken in the
+// middle of an exchange
+int Searcher::quiesce(int alpha, int beta) {
+    if (stopped()) return 0;
+    STATS_INC(qnodes);
+    int standPat = game.evaluate();
+    if (standPat >= beta) return standPat;
+    if (standPat > alpha) alpha = standPat;
+
+    vector<Move> moves = game.generateValidMoves();
+    vector<Move> captures;
+    for (const Move& m : moves) if (game.getPieceAt(m.endR, m.endC) != '.') captures.push_back(m);
+    orderMoves(captures, 0);
+
+    for (const Move& m : captures) {
+        char captured = make(m);
+        int score = -quiesce(-beta, -alpha);
+        unmake(m, captured);
+        if (score >= beta) return score;
+        if (score > alpha) alpha = score;
+    }
+    return alpha;
+}
+
+} // namespace
+
+vector<AnalysisLine> analyzePosition(const ChessGame& position, const AnalysisOptions& options, TranspositionTable* tt) {
+    ChessGame game = position; // Search a copy; the caller's position is never touched
+    Searcher searcher(game, tt, options.stop);
+    int multiPV = max(1, options.multiPV);
+
+    vector<Move> rootMoves = game.generateValidMoves();
+    orderMoves(rootMoves, 0);
+
+    vector<AnalysisLine> lines, completed;
+    vector<Move> childPv;
+    // Iterative deepening: each pass re-sorts the root moves by the previous
+    // pass's scores and leaves hash moves behind for the next one.
+    for (int depth = 1; depth <= max(1, options.depth); ++depth) {
+        lines.clear();
+        for (Move& m : rootMoves) {
+            // Only a move that beats the current N-th best line can enter the list
+            int alpha = int(lines.size()) >= multiPV ? lines.back().score : -INFINITE_SCORE;
+            char captured = searcher.make(m);
+            int score = -searcher.negamax(depth - 1, -INFINITE_SCORE, -alpha, 1, childPv);
+            searcher.unmake(m, captured);
+            if (searcher.stopped()) return completed;
+            m.score = score;
+
+            if (int(lines.size()) < multiPV || score > alpha) {
+                AnalysisLine line;
+                line.move = m;
+                line.score = score;
+                line.pv.assign(1, m);
+                line.pv.insert(line.pv.end(), childPv.begin(), childPv.end());
+                auto pos = lines.begin();
+                while (pos != lines.end() && pos->score >= score) ++pos;
+                lines.insert(pos, line);
+                if (int(lines.size()) > multiPV) lines.pop_back();
+            }
+        }
+        stable_sort(rootMoves.begin(), rootMoves.end(), [](const Move& a, const Move& b) { return a.score > b.score; });
+        completed = lines;
+    }
+    return completed;
+}
+
+vector<vector<AnalysisLine>> analyzeBatch(const vector<ChessGame>& positions, const AnalysisOptions& options,
+                                          TranspositionTable& tt, unsigned threadCount) {
+    vector<vector<AnalysisLine>> results(positions.size());
+    if (threadCount == 0) threadCount = max(1u, thread::hardware_concurrency());
+    threadCount = unsigned(min<size_t>(threadCount, positions.size()));
+
+    // Threads take the next unclaimed position until none are left
+    atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < positions.size(); i = next++) {
+            results[i] = analyzePosition(positions[i], options, &tt);
+        }
+    };
+
+    vector<thread> pool;
+    for (unsigned t = 1; t < threadCount; ++t) pool.emplace_back(worker);
+    worker(); // The calling thread works too
+    for (thread& t : pool) t.join();
+    return results;
+}
+
+string formatAnalysisLine(const ChessGame& position, const AnalysisLine& line) {
+    char scoreText[16];
+    if (line.score > MATE_BOUND) snprintf(scoreText, sizeof(scoreText), "#%d", (MATE_SCORE - line.score + 1) / 2);
+    else if (line.score < -MATE_BOUND) snprintf(scoreText, sizeof(scoreText), "#-%d", (MATE_SCORE + line.score + 1) / 2);
+    else snprintf(scoreText, sizeof(scoreText), "%+.1f", line.score / 10.0);
+
+    string text = scoreText;
+    for (const Move& m : line.pv) text += " " + position.indexToNotation(m.startR, m.startC) + position.indexToNotation(m.endR, m.endC);
+    return text;
+}
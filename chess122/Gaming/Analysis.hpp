@@ -0,0 +1,82 @@
+#ifndef ANALYSIS_HPP
+#define ANALYSIS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ChessGame.hpp"
+#include "MoveHistory.hpp"
+
+// --- Analysis API ---
+// Searches a position without touching it and reports the best N lines.
+// Scores are from the side to move's point of view in getPieceValue units
+// (a pawn is 10); mates are reported as +/- (MATE_SCORE - plies to mate).
+
+const int MATE_SCORE = 30000;
+const int INFINITE_SCORE = 32000;
+
+struct AnalysisOptions {
+    int depth = 3;      // Full-width plies; captures are followed further
+    int multiPV = 1;    // Number of best lines to report
+    // Optional: once this becomes true the search unwinds at the next node and
+    // returns the lines of the last depth it finished (empty if none)
+    const std::atomic<bool>* stop = nullptr;
+};
+
+struct AnalysisLine {
+    Move move;              // First move of the line
+    int score = 0;
+    std::vector<Move> pv;   // Principal variation, starting with move
+};
+
+// --- Transposition Table ---
+// Fixed-size, always-replace hash table that several search threads can
+// share without locks: each slot stores the key XOR-ed with its data, so a
+// slot torn by two concurrent writers simply fails the key check on probe.
+class TranspositionTable {
+public:
+    enum Bound : std::uint8_t { BOUND_UPPER = 0, BOUND_LOWER = 1, BOUND_EXACT = 2 };
+
+    struct Entry {
+        PackedMove move = 0;    // 0 when no best move is known
+        int score = 0;
+        int depth = 0;
+        Bound bound = BOUND_UPPER;
+    };
+
+    explicit TranspositionTable(std::size_t megabytes = 16);
+
+    bool probe(std::uint64_t key, Entry& out) const;
+    void store(std::uint64_t key, PackedMove move, int score, int depth, Bound bound);
+    void clear();
+
+private:
+    struct Slot {
+        std::atomic<std::uint64_t> check{0};  // key ^ data
+        std::atomic<std::uint64_t> data{0};
+    };
+    std::unique_ptr<Slot[]> slots;
+    std::size_t mask = 0;
+};
+
+// Zobrist hash of the piece placement and side to move
+std::uint64_t hashPosition(const ChessGame& position);
+
+// Top options.multiPV lines for the side to move, best first. Empty when
+// the side to move has no legal moves. tt may be null.
+std::vector<AnalysisLine> analyzePosition(const ChessGame& position, const AnalysisOptions& options,
+                                          TranspositionTable* tt = nullptr);
+
+// Analyses every position, spreading them over threadCount threads
+// (0 = one per hardware thread) that all share tt. result[i] belongs to positions[i].
+std::vector<std::vector<AnalysisLine>> analyzeBatch(const std::vector<ChessGame>& positions, const AnalysisOptions& options,
+                                                    TranspositionTable& tt, unsigned threadCount = 0);
+
+// "+1.0  e2e4 e7e5 g1f3" style summary of a line
+std::string formatAnalysisLine(const ChessGame& position, const AnalysisLine& line);
+
+#endif // ANALYSIS_HPP
@@ -0,0 +1,455 @@
+#include "ChessGame.hpp"
+
+#include <cmath>    // For abs
+#include <cstdlib>  // For rand(), srand()
+#include <ctime>     // For srand(time(0))
+#include <sstream>   // For parsing FEN
+
+
+using namespace std;
+
+// --- Attack & Check Logic ---
+bool ChessGame::isSquareAttacked(int r, int c, bool attackerIsWhite) const {
+    STATS_INC(attackProbes);
+    char attackingPawn = attackerIsWhite ? 'P' : 'p'; char attackingRook = attackerIsWhite ? 'R' : 'r';
+    char attackingKnight = attackerIsWhite ? 'N' : 'n'; char attackingBishop = attackerIsWhite ? 'B' : 'b';
+    char attackingQueen = attackerIsWhite ? 'Q' : 'q'; char attackingKing = attackerIsWhite ? 'K' : 'k';
+    int pawnAttackSourceDir = attackerIsWhite ? 1 : -1; // Direction FROM which pawn attacks
+    // Pawn attacks
+    if (isWithinBounds(r + pawnAttackSourceDir, c - 1) && getPieceAt(r + pawnAttackSourceDir, c - 1) == attackingPawn) return true;
+    if (isWithinBounds(r + pawnAttackSourceDir, c + 1) && getPieceAt(r + pawnAttackSourceDir, c + 1) == attackingPawn) return true;
+    // Knight attacks
+    int knightMoves[8][2] = {{-2,-1},{-2,1},{-1,-2},{-1,2},{1,-2},{1,2},{2,-1},{2,1}};
+    for(const auto& m:knightMoves) if(isWithinBounds(r+m[0],c+m[1])&&getPieceAt(r+m[0],c+m[1])==attackingKnight) return true;
+    // Rook/Queen (straight) attacks
+    int rookDirs[4][2] = {{-1,0},{1,0},{0,-1},{0,1}};
+    for(const auto& d:rookDirs) for(int i=1;;++i){int nr=r+i*d[0],nc=c+i*d[1]; if(!isWithinBounds(nr,nc))break; char pc=getPieceAt(nr,nc); if(pc!='.'&& pc != ' '){if(pc==attackingRook||pc==attackingQueen)return true; break;} /* Stop if blocked */}
+    // Bishop/Queen (diagonal) attacks
+    int bishopDirs[4][2] = {{-1,-1},{-1,1},{1,-1},{1,1}};
+    for(const auto& d:bishopDirs) for(int i=1;;++i){int nr=r+i*d[0],nc=c+i*d[1]; if(!isWithinBounds(nr,nc))break; char pc=getPieceAt(nr,nc); if(pc!='.' && pc != ' '){if(pc==attackingBishop||pc==attackingQueen)return true; break;}/* Stop if blocked */}
+    // King attacks
+    for(int dr=-1;dr<=1;++dr)for(int dc=-1;dc<=1;++dc){if(dr==0&&dc==0)continue; if(isWithinBounds(r+dr,c+dc)&&getPieceAt(r+dr,c+dc)==attackingKing)return true;}
+    return false;
+}
+
+bool ChessGame::moveLeavesKingInCheck(int startR, int startC, int endR, int endC) {
+    char piece = board[startR][startC];
+    char target = board[endR][endC];
+    board[endR][endC] = piece;
+    board[startR][startC] = '.';
+
+    int origKR = -1, origKC = -1;
+    if (tolower(piece) == 'k') {
+        if (isWhiteTurn) {
+            origKR = whiteKingRow; origKC = whiteKingCol;
+            whiteKingRow = endR; whiteKingCol = endC;
+        } else {
+            origKR = blackKingRow; origKC = blackKingCol;
+            blackKingRow = endR; blackKingCol = endC;
+        }
+    }
+
+    // Check if the current player's king is now in check
+    bool inCheck = isKingInCheck(isWhiteTurn);
+
+    // Undo the temporary move
+    board[startR][startC] = piece;
+    board[endR][endC] = target;
+
+    // Restore king position if it was moved
+    if (origKR != -1) {
+        if (isWhiteTurn) {
+            whiteKingRow = origKR; whiteKingCol = origKC;
+        } else {
+            blackKingRow = origKR; blackKingCol = origKC;
+        }
+    }
+    return inCheck;
+}
+
+bool ChessGame::isKingInCheck(bool checkWhiteKing) const {
+    int kr = checkWhiteKing ? whiteKingRow : blackKingRow;
+    int kc = checkWhiteKing ? whiteKingCol : blackKingCol;
+    // King is in check if the square it's on is attacked by the opponent
+    return isSquareAttacked(kr, kc, !checkWhiteKing);
+}
+
+// --- Move Validation Logic ---
+// Overload without error message for internal/AI use
+bool ChessGame::isMoveValid(int startR, int startC, int endR, int endC) {
+    string dummyError;
+    return isMoveValid(startR, startC, endR, endC, dummyError);
+}
+
+// Original validation logic with error message
+bool ChessGame::isMoveValid(int startR, int startC, int endR, int endC, string& errorMsg) {
+    errorMsg = "";
+    if (!isWithinBounds(startR, startC) || !isWithinBounds(endR, endC)) {
+        errorMsg = "Coordinates out of bounds."; return false;
+    }
+    char piece = getPieceAt(startR, startC);
+    if (piece == '.' || piece == ' ') {
+        errorMsg = "No piece at starting square " + indexToNotation(startR, startC) + "."; return false;
+    }
+    // Check if the piece belongs to the current player
+    if ((isWhiteTurn && !isPieceWhite(piece)) || (!isWhiteTurn && !isPieceBlack(piece))) {
+        errorMsg = "It's not that piece's turn (" + string(1,piece) + " at " + indexToNotation(startR,startC)+")."; return false;
+    }
+
+    char target = getPieceAt(endR, endC);
+    // Check if capturing own piece
+    if (target != '.' && target != ' ' && ((isWhiteTurn && isPieceWhite(target)) || (!isWhiteTurn && isPieceBlack(target)))) {
+        errorMsg = "Cannot capture your own piece at " + indexToNotation(endR, endC) + "."; return false;
+    }
+
+    if (startR == endR && startC == endC) {
+        errorMsg = "Start and end square cannot be the same."; return false;
+    }
+
+    // Validate piece-specific movement rules
+    bool validPattern = false;
+    switch (tolower(piece)) {
+        case 'p': validPattern = isValidPawnMove(startR, startC, endR, endC, target); break;
+        case 'r': validPattern = isValidRookMove(startR, startC, endR, endC); break;
+        case 'n': validPattern = isValidKnightMove(startR, startC, endR, endC); break;
+        case 'b': validPattern = isValidBishopMove(startR, startC, endR, endC); break;
+        case 'q': validPattern = isValidQueenMove(startR, startC, endR, endC); break;
+        case 'k': validPattern = isValidKingMove(startR, startC, endR, endC); break;
+        default:  errorMsg = "Unknown piece type."; return false; // Should not happen
+    }
+
+    if (!validPattern) {
+        errorMsg = "Invalid move pattern for " + string(1, piece) + " from " + indexToNotation(startR, startC) + " to " + indexToNotation(endR, endC) + ".";
+        return false;
+    }
+
+    // Check if the move leaves the king in check (most crucial check)
+    if (moveLeavesKingInCheck(startR, startC, endR, endC)) {
+        errorMsg = "Move leaves your king in check.";
+        return false;
+    }
+
+    // Add Castling/En Passant logic here if implementing them
+
+    return true; // If all checks pass
+}
+// --- Piece Specific Move Logic (Mostly unchanged, ensure use '.' for empty) ---
+bool ChessGame::isValidPawnMove(int sr, int sc, int er, int ec, char target) const {char p=getPieceAt(sr,sc); int dir=isPieceWhite(p)?-1:1; int start=isPieceWhite(p)?6:1; // Check forward 1 square
+    if(sc==ec&&er==sr+dir&&getPieceAt(er,ec)=='.')return true; // Check forward 2 squares from start
+    if(sc==ec&&sr==start&&er==sr+2*dir&&getPieceAt(er,ec)=='.'&&getPieceAt(sr+dir,sc)=='.')return true; // Check diagonal capture
+    if(abs(sc-ec)==1&&er==sr+dir&&(target!='.'&&target!=' '))return true; // Add En Passant check here if needed
+    return false;}
+bool ChessGame::isValidRookMove(int sr, int sc, int er, int ec) const {if(sr!=er&&sc!=ec)return false; int stepR=(er>sr)?1:((er<sr)?-1:0); int stepC=(ec>sc)?1:((ec<sc)?-1:0); int cr=sr+stepR; int cc=sc+stepC; while(cr!=er||cc!=ec){if(getPieceAt(cr,cc)!='.')return false; cr+=stepR; cc+=stepC;} return true;}
+bool ChessGame::isValidKnightMove(int sr, int sc, int er, int ec) const {int dr=abs(sr-er); int dc=abs(sc-ec); return (dr==2&&dc==1)||(dr==1&&dc==2);}
+bool ChessGame::isValidBishopMove(int sr, int sc, int er, int ec) const {if(abs(sr-er)!=abs(sc-ec))return false; int stepR=(er>sr)?1:-1; int stepC=(ec>sc)?1:-1; int cr=sr+stepR; int cc=sc+stepC; while(cr!=er||cc!=ec){if(getPieceAt(cr,cc)!='.')return false; cr+=stepR; cc+=stepC;} return true;}
+bool ChessGame::isValidQueenMove(int sr, int sc, int er, int ec) const {return isValidRookMove(sr,sc,er,ec)||isValidBishopMove(sr,sc,er,ec);}
+bool ChessGame::isValidKingMove(int sr, int sc, int er, int ec) const {int dr=abs(sr-er); int dc=abs(sc-ec); return dr<=1&&dc<=1; /*Add castling check here*/}
+
+// --- AI Specific Logic ---
+
+// Get the value of a piece (for capture priority)
+int ChessGame::getPieceValue(char piece) const {
+    switch (tolower(piece)) {
+        case 'p': return 10;
+        case 'n': return 30;
+        case 'b': return 30;
+        case 'r': return 50;
+        case 'q': return 90;
+        case 'k': return 900; // King value is high, but capture isn't the goal
+        default: return 0;
+    }
+}
+
+// Material balance from the point of view of the side to move
+int ChessGame::evaluate() const {
+    STATS_TIMER(evaluationNs);
+    int balance = 0;
+    for (int r = 0; r < BOARD_SIZE; ++r) {
+        for (int c = 0; c < BOARD_SIZE; ++c) {
+            char piece = board[r][c];
+            if (piece == '.' || tolower(piece) == 'k') continue; // Kings are never traded
+            balance += isPieceWhite(piece) ? getPieceValue(piece) : -getPieceValue(piece);
+        }
+    }
+    return isWhiteTurn ? balance : -balance;
+}
+
+// Generate all valid moves for the current player
+vector<Move> ChessGame::generateValidMoves() {
+    STATS_TIMER(generationNs);
+    STATS_INC(nodes);
+    vector<Move> validMoves;
+    char piece;
+    // One timer for the whole loop: timing each of the 1024 from/to pairs
+    // would mostly measure the clock
+    STATS_TIMER(validationNs);
+    for (int r = 0; r < BOARD_SIZE; ++r) {
+        for (int c = 0; c < BOARD_SIZE; ++c) {
+            piece = getPieceAt(r, c);
+            // Check if it's a piece belonging to the current player
+            if (piece != '.' && piece != ' ' && ((isWhiteTurn && isPieceWhite(piece)) || (!isWhiteTurn && isPieceBlack(piece)))) {
+                // Try moving this piece to every other square
+                for (int er = 0; er < BOARD_SIZE; ++er) {
+                    for (int ec = 0; ec < BOARD_SIZE; ++ec) {
+                        STATS_INC(movesTried);
+                        if (isMoveValid(r, c, er, ec)) { // Use the internal validation
+                            STATS_INC(legalMoves);
+                            Move currentMove(r, c, er, ec);
+                            // Score the move (simple capture scoring)
+                            char targetPiece = getPieceAt(er, ec);
+                            if (targetPiece != '.' && targetPiece != ' ') {
+                                currentMove.score = getPieceValue(targetPiece);
+                            } else {
+                                currentMove.score = 1; // Give non-captures a small score
+                            }
+                            validMoves.push_back(currentMove);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return validMoves;
+}
+
+// AI makes its move (returns true if a move was made, false if no moves possible)
+bool ChessGame::makeAIMove() {
+    vector<Move> bestMoves = bestAIMoves();
+
+    if (bestMoves.empty()) {
+        return false; // No legal moves - game over (checkmate or stalemate)
+    }
+
+    playRandomMove(bestMoves);
+    return true;
+}
+
+vector<Move> ChessGame::bestAIMoves() {
+    vector<Move> validMoves = generateValidMoves();
+
+    // Find the best move (highest score)
+    int bestScore = -1;
+    for(const auto& move : validMoves) {
+         if (move.score > bestScore) {
+             bestScore = move.score;
+         }
+    }
+
+    // Collect all moves with the best score
+    vector<Move> bestMoves;
+    for (const auto& move : validMoves) {
+        if (move.score == bestScore) {
+            bestMoves.push_back(move);
+        }
+    }
+    return bestMoves;
+}
+
+void ChessGame::playRandomMove(const vector<Move>& bestMoves) {
+    // Choose randomly among the best moves
+    int chosenIndex = rand() % bestMoves.size();
+    Move chosenMove = bestMoves[chosenIndex];
+
+    // Make the chosen move
+    makeMove(chosenMove.startR, chosenMove.startC, chosenMove.endR, chosenMove.endC);
+}
+
+ChessGame::ChessGame() : isWhiteTurn(true) {
+    initializeBoard();
+    srand(time(0)); // Seed random number generator for AI
+}
+
+void ChessGame::initializeBoard() {
+    // Initializes the 8x8 board (use '.' for empty)
+    board[0][0]='r'; board[0][1]='n'; board[0][2]='b'; board[0][3]='q'; board[0][4]='k'; board[0][5]='b'; board[0][6]='n'; board[0][7]='r'; // Rank 8
+    for(int j=0;j<BOARD_SIZE;++j) board[1][j]='p'; // Rank 7
+    for(int i=2;i<6;++i) for(int j=0;j<BOARD_SIZE;++j) board[i][j]='.'; // Ranks 6,5,4,3 are empty
+    for(int j=0;j<BOARD_SIZE;++j) board[6][j]='P'; // Rank 2
+    board[7][0]='R'; board[7][1]='N'; board[7][2]='B'; board[7][3]='Q'; board[7][4]='K'; board[7][5]='B'; board[7][6]='N'; board[7][7]='R'; // Rank 1
+    whiteKingRow=7; whiteKingCol=4; blackKingRow=0; blackKingCol=4;
+    whiteCaptured.clear(); blackCaptured.clear();
+    lastMoveNotation="N/A"; isWhiteTurn=true;
+    history.clear(); startFen = "";
+}
+
+bool ChessGame::loadFEN(const string& fen, string& errorMsg) {
+    errorMsg = "";
+    istringstream fields(fen);
+    string placement, side;
+    if (!(fields >> placement >> side)) {
+        errorMsg = "FEN needs at least piece placement and side to move."; return false;
+    }
+
+    char newBoard[BOARD_SIZE][BOARD_SIZE];
+    int whiteKings = 0, blackKings = 0, wkr = -1, wkc = -1, bkr = -1, bkc = -1;
+    int r = 0, c = 0;
+    for (char ch : placement) {
+        if (ch == '/') {
+            if (c != BOARD_SIZE) { errorMsg = "FEN rank " + to_string(8 - r) + " does not have 8 squares."; return false; }
+            ++r; c = 0;
+            if (r >= BOARD_SIZE) { errorMsg = "FEN has more than 8 ranks."; return false; }
+        } else if (ch >= '1' && ch <= '8') {
+            for (int n = ch - '0'; n > 0; --n) {
+                if (c >= BOARD_SIZE) { errorMsg = "FEN rank " + to_string(8 - r) + " is too long."; return false; }
+                newBoard[r][c++] = '.';
+            }
+        } else if (string("pnbrqkPNBRQK").find(ch) != string::npos) {
+            if (c >= BOARD_SIZE) { errorMsg = "FEN rank " + to_string(8 - r) + " is too long."; return false; }
+            if (ch == 'K') { ++whiteKings; wkr = r; wkc = c; }
+            if (ch == 'k') { ++blackKings; bkr = r; bkc = c; }
+            newBoard[r][c++] = ch;
+        } else {
+            errorMsg = "Unexpected character '" + string(1, ch) + "' in FEN."; return false;
+        }
+    }
+    if (r != BOARD_SIZE - 1 || c != BOARD_SIZE) { errorMsg = "FEN must describe all 8 ranks."; return false; }
+    if (whiteKings != 1 || blackKings != 1) { errorMsg = "FEN must contain exactly one king per side."; return false; }
+    if (side != "w" && side != "b") { errorMsg = "Side to move must be 'w' or 'b'."; return false; }
+
+    // Set the position up on a copy first: the side that just moved cannot
+    // have left its king in check, and searching such a position would
+    // capture that king
+    ChessGame placed = *this;
+    for (int i = 0; i < BOARD_SIZE; ++i) for (int j = 0; j < BOARD_SIZE; ++j) placed.board[i][j] = newBoard[i][j];
+    placed.whiteKingRow = wkr; placed.whiteKingCol = wkc; placed.blackKingRow = bkr; placed.blackKingCol = bkc;
+    placed.isWhiteTurn = (side == "w");
+    if (placed.isKingInCheck(!placed.isWhiteTurn)) { errorMsg = "Side not to move is in check."; return false; }
+
+    *this = placed;
+    whiteCaptured.clear(); blackCaptured.clear();
+    lastMoveNotation = "N/A";
+    history.clear(); startFen = fen;
+    return true;
+}
+
+// Performs the move actions on the board
+void ChessGame::makeMove(int startR, int startC, int endR, int endC) {
+    history.record(UndoRecord{packMove(startR, startC, endR, endC), board[endR][endC]});
+    applyMove(startR, startC, endR, endC);
+}
+
+void ChessGame::applyMove(int startR, int startC, int endR, int endC) {
+    char pieceMoved = board[startR][startC];
+    char capturedPiece = board[endR][endC];
+
+    // Record capture
+    if (capturedPiece != '.' && capturedPiece != ' ') {
+        if (isPieceWhite(capturedPiece)) { // Black captured White
+            blackCaptured.push_back(capturedPiece);
+        } else {
+            whiteCaptured.push_back(capturedPiece);
+        }
+    }
+
+    // Move piece
+    board[endR][endC] = pieceMoved;
+    board[startR][startC] = '.'; // Mark origin as empty
+
+    // Update King's position if King moved
+    if (tolower(pieceMoved) == 'k') {
+        if (isWhiteTurn) {
+            whiteKingRow = endR; whiteKingCol = endC;
+        } else {
+            blackKingRow = endR; blackKingCol = endC;
+        }
+    }
+
+    // Update last move notation
+    lastMoveNotation = indexToNotation(startR, startC);
+    lastMoveNotation += (capturedPiece != '.' && capturedPiece != ' ') ? "x" : "-"; // Capture notation
+    lastMoveNotation += indexToNotation(endR, endC);
+
+    // Check if the move puts the *opponent* in check
+    bool opponentInCheck = isKingInCheck(!isWhiteTurn);
+    if (opponentInCheck) {
+        lastMoveNotation += "+"; // Check notation
+    }
+
+
+    // Switch turns
+    isWhiteTurn = !isWhiteTurn;
+}
+
+char ChessGame::makeSearchMove(int startR, int startC, int endR, int endC) {
+    char piece = board[startR][startC];
+    char captured = board[endR][endC];
+    board[endR][endC] = piece;
+    board[startR][startC] = '.';
+    if (piece == 'K') { whiteKingRow = endR; whiteKingCol = endC; }
+    else if (piece == 'k') { blackKingRow = endR; blackKingCol = endC; }
+    isWhiteTurn = !isWhiteTurn;
+    return captured;
+}
+
+void ChessGame::unmakeSearchMove(int startR, int startC, int endR, int endC, char captured) {
+    char piece = board[endR][endC];
+    board[startR][startC] = piece;
+    board[endR][endC] = captured;
+    if (piece == 'K') { whiteKingRow = startR; whiteKingCol = startC; }
+    else if (piece == 'k') { blackKingRow = startR; blackKingCol = startC; }
+    isWhiteTurn = !isWhiteTurn;
+}
+
+bool ChessGame::undoMove() {
+    if (!history.canUndo()) return false;
+    const UndoRecord& rec = history.undo();
+    int startR, startC, endR, endC;
+    unpackMove(rec.move, startR, startC, endR, endC);
+
+    // Put the piece back and restore whatever it captured
+    char pieceMoved = board[endR][endC];
+    board[startR][startC] = pieceMoved;
+    board[endR][endC] = rec.captured;
+    isWhiteTurn = !isWhiteTurn;
+    if (rec.captured != '.') {
+        if (isPieceWhite(rec.captured)) blackCaptured.pop_back(); else whiteCaptured.pop_back();
+    }
+    if (tolower(pieceMoved) == 'k') {
+        if (isWhiteTurn) { whiteKingRow = startR; whiteKingCol = startC; }
+        else { blackKingRow = startR; blackKingCol = startC; }
+    }
+
+    // The board is now exactly as it was after the previous move, so its
+    // notation (including the check marker) can be rebuilt from the history.
+    if (history.canUndo()) {
+        const UndoRecord& prev = history.last();
+        int sr, sc, er, ec;
+        unpackMove(prev.move, sr, sc, er, ec);
+        lastMoveNotation = indexToNotation(sr, sc) + (prev.captured != '.' ? "x" : "-") + indexToNotation(er, ec);
+        if (isKingInCheck(isWhiteTurn)) lastMoveNotation += "+";
+    } else {
+        lastMoveNotation = "N/A";
+    }
+    return true;
+}
+
+bool ChessGame::redoMove() {
+    if (!history.canRedo()) return false;
+    int startR, startC, endR, endC;
+    unpackMove(history.redo().move, startR, startC, endR, endC);
+    applyMove(startR, startC, endR, endC);
+    return true;
+}
+
+bool ChessGame::saveGame(const string& path, GameResult result, string& errorMsg) const {
+    return appendGameRecord(path, startFen, history.playedMoves(), result, errorMsg);
+}
+
+bool ChessGame::loadGame(const GameView& game, string& errorMsg) {
+    // Replay into a copy so a bad record leaves this game untouched
+    ChessGame replay = *this;
+    if (game.startFen.empty()) replay.initializeBoard();
+    else if (!replay.loadFEN(game.startFen, errorMsg)) return false;
+    for (uint32_t ply = 0; ply < game.plyCount; ++ply) {
+        int startR, startC, endR, endC;
+        unpackMove(game.move(ply), startR, startC, endR, endC);
+        if (!replay.isMoveValid(startR, startC, endR, endC, errorMsg)) {
+            errorMsg = "Recorded move " + to_string(ply + 1) + " is illegal: " + errorMsg;
+            return false;
+        }
+        replay.makeMove(startR, startC, endR, endC);
+    }
+
+    *this = replay;
+    return true;
+}
@@ -0,0 +1,126 @@
+#ifndef CHESS_GAME_HPP
+#define CHESS_GAME_HPP
+
+#include <cctype>   // For isupper, islower, tolower
+#include <string>
+#include <vector>
+
+#include "EngineStats.hpp"
+#include "GameRecord.hpp"
+#include "MoveHistory.hpp"
+
+// --- Configuration ---
+const int BOARD_SIZE = 8; // Board dimensions are 8x8
+
+// --- Helper Functions ---
+
+inline bool isWithinBounds(int r, int c) { return r >= 0 && r < BOARD_SIZE && c >= 0 && c < BOARD_SIZE; }
+
+// --- Structure to represent a move ---
+struct Move {
+    int startR, startC, endR, endC;
+    int score = 0;
+
+    // Default constructor
+    Move(int sr = -1, int sc = -1, int er = -1, int ec = -1, int s = 0)
+        : startR(sr), startC(sc), endR(er), endC(ec), score(s) {}
+};
+
+
+// --- ChessGame Class ---
+class ChessGame {
+private:
+    // Board is defined as 8x8
+    char board[BOARD_SIZE][BOARD_SIZE];
+    bool isWhiteTurn;
+    int whiteKingRow, whiteKingCol;
+    int blackKingRow, blackKingCol;
+    std::string lastMoveNotation = "N/A";
+    std::vector<char> whiteCaptured;
+    std::vector<char> blackCaptured;
+    MoveHistory history;
+    std::string startFen;       // Position the history starts from, empty for the standard start
+
+    // --- Basic Helpers ---
+    // Moves the piece and updates captures, king position, notation and turn
+    void applyMove(int startR, int startC, int endR, int endC);
+
+    // --- Piece Specific Move Logic ---
+    bool isValidPawnMove(int sr, int sc, int er, int ec, char target) const;
+    bool isValidRookMove(int sr, int sc, int er, int ec) const;
+    bool isValidKnightMove(int sr, int sc, int er, int ec) const;
+    bool isValidBishopMove(int sr, int sc, int er, int ec) const;
+    bool isValidQueenMove(int sr, int sc, int er, int ec) const;
+    bool isValidKingMove(int sr, int sc, int er, int ec) const;
+
+public:
+    ChessGame();
+
+    void initializeBoard();
+
+    // Sets up the position from a FEN string. Only the piece placement and
+    // side to move are used; castling and en passant fields are accepted but
+    // ignored since neither rule is implemented. On failure the game is left
+    // unchanged and errorMsg explains why.
+    bool loadFEN(const std::string& fen, std::string& errorMsg);
+
+    // --- Board Queries ---
+    bool notationToIndex(const std::string& n, int& r, int& c) const { if(n.length()!=2) return false; char f=tolower(n[0]); char rnk=n[1]; if(f<'a'||f>'h'||rnk<'1'||rnk>'8') return false; c=f-'a'; r='8'-rnk; return isWithinBounds(r,c); }
+    std::string indexToNotation(int r, int c) const { if(!isWithinBounds(r,c)) return "??"; char f='a'+c; char rnk='8'-r; std::string s=""; s+=f; s+=rnk; return s; }
+    char getPieceAt(int r, int c) const { if(!isWithinBounds(r,c)) return ' '; return board[r][c]; }
+    bool isPieceWhite(char p) const { return p!='.'&&p!=' '&&isupper(p); }
+    bool isPieceBlack(char p) const { return p!='.'&&p!=' '&&islower(p); }
+    bool whiteToMove() const { return isWhiteTurn; }
+    const std::string& getLastMoveNotation() const { return lastMoveNotation; }
+    // Pieces taken so far by White (true) or Black (false)
+    const std::vector<char>& capturedBy(bool white) const { return white ? whiteCaptured : blackCaptured; }
+
+    // --- Attack & Check Logic ---
+    bool isSquareAttacked(int r, int c, bool attackerIsWhite) const;
+    bool moveLeavesKingInCheck(int startR, int startC, int endR, int endC);
+    bool isKingInCheck(bool checkWhiteKing) const;
+
+    // --- Move Validation Logic ---
+    // Overload without error message for internal/AI use
+    bool isMoveValid(int startR, int startC, int endR, int endC);
+    bool isMoveValid(int startR, int startC, int endR, int endC, std::string& errorMsg);
+
+    // --- Move Generation & Evaluation ---
+    // Get the value of a piece (for capture priority)
+    int getPieceValue(char piece) const;
+    // Generate all valid moves for the current player
+    std::vector<Move> generateValidMoves();
+    // Material balance from the point of view of the side to move
+    int evaluate() const;
+    // The moves the AI rates highest in this position (all ties kept)
+    std::vector<Move> bestAIMoves();
+
+    // --- AI Specific Logic ---
+    // AI makes its move (returns true if a move was made, false if no moves possible)
+    bool makeAIMove();
+    // Plays one of the given equally good moves at random
+    void playRandomMove(const std::vector<Move>& bestMoves);
+
+    // Performs the move actions on the board
+    void makeMove(int startR, int startC, int endR, int endC);
+
+    // --- Search Moves ---
+    // Bare make/unmake for tree search: only the board, king squares and side
+    // to move change. History, notation and captured lists are left alone, so
+    // every makeSearchMove must be undone by unmakeSearchMove with the piece it
+    // returned before the game is used normally again.
+    char makeSearchMove(int startR, int startC, int endR, int endC);
+    void unmakeSearchMove(int startR, int startC, int endR, int endC, char captured);
+
+    // --- History ---
+    // Take back / replay one ply. Both return false when there is nothing to do.
+    bool undoMove();
+    bool redoMove();
+    std::size_t historySize() const { return history.size(); }
+    // Appends the moves played so far to a binary game record file
+    bool saveGame(const std::string& path, GameResult result, std::string& errorMsg) const;
+    // Sets up a recorded game's start position and replays all its moves
+    bool loadGame(const GameView& game, std::string& errorMsg);
+};
+
+#endif // CHESS_GAME_HPP
@@ -0,0 +1,363 @@
+#include "ConsoleGame.hpp"
+
+#include <iostream>
+#include <cstdlib>  // For system()
+#include <limits>   // Required for numeric_limits
+#include <thread>    // For sleep
+#include <chrono>    // For sleep_for
+#include <sstream>   // For building the stats report
+
+#include "Analysis.hpp"
+#include "Ponder.hpp"
+
+
+using namespace std;
+
+// --- Helper Functions ---
+
+string getPieceVisual(char piece) {
+    if (USE_UNICODE_SYMBOLS) {
+        switch (piece) {
+            case 'P': return u8"\u2659"; case 'p': return u8"\u265F"; case 'R': return u8"\u2656"; case 'r': return u8"\u265C";
+            case 'N': return u8"\u2658"; case 'n': return u8"\u265E"; case 'B': return u8"\u2657"; case 'b': return u8"\u265D";
+            case 'Q': return u8"\u2655"; case 'q': return u8"\u265B"; case 'K': return u8"\u2654"; case 'k': return u8"\u265A";
+            default: return " "; // Use space for empty with Unicode
+        }
+    } else {
+        if (piece == ' ' || piece == '.') return "."; // Use dot for empty with ASCII
+        string s(1, piece); return s;
+    }
+}
+
+// --- Basic Helpers ---
+void ConsoleGame::clearScreen() {
+    #ifdef _WIN32
+        system("cls");
+    #else
+        system("clear");
+    #endif
+}
+
+ConsoleGame::ConsoleGame() {
+    resetStats();
+}
+
+string ConsoleGame::playerName(bool white) const {
+    if (twoPlayer) return white ? "White" : "Black";
+    return white ? "White (You)" : "Black (AI)";
+}
+
+// --- Instrumentation Helpers ---
+
+// Starts counting afresh, e.g. for a newly loaded game whose moves were
+// replayed rather than searched
+void ConsoleGame::resetStats() {
+    plyStats.assign(game.historySize(), EngineStats());
+    engineStats().reset();
+}
+
+// Closes the current move's counters: stores them against the ply just played,
+// logs them if requested and starts counting afresh for the next move.
+void ConsoleGame::recordMoveStats(bool moverWasWhite) {
+#if CHESS_ENABLE_STATS
+    size_t ply = game.historySize();
+    plyStats.resize(ply - 1); // A new move discards any plies that could have been redone
+    plyStats.push_back(engineStats());
+    if (statsLog.is_open()) {
+        writeEngineStatsJson(statsLog, static_cast<int>(ply), moverWasWhite ? "white" : "black", game.getLastMoveNotation(), plyStats.back());
+    }
+    engineStats().reset();
+#else
+    (void)moverWasWhite;
+#endif
+}
+
+string ConsoleGame::statsReport() const {
+#if CHESS_ENABLE_STATS
+    // Only the plies still on the board count; undone ones wait for a redo
+    size_t plies = game.historySize();
+    EngineStats gameStats;
+    for (size_t i = 0; i < plies; ++i) gameStats += plyStats[i];
+    ostringstream out;
+    printEngineStats(out, "Last move (" + game.getLastMoveNotation() + ")", plies ? plyStats[plies - 1] : EngineStats());
+    printEngineStats(out, "Game total (" + to_string(plies) + " plies)", gameStats);
+    if (ponderEnabled) out << " Ponder hits: " << ponderHits << "   misses: " << ponderMisses << endl;
+    return out.str();
+#else
+    string report = " Engine statistics are compiled out of this build (NDEBUG).\n";
+    if (ponderEnabled) report += " Ponder hits: " + to_string(ponderHits) + "   misses: " + to_string(ponderMisses) + "\n";
+    return report;
+#endif
+}
+
+// Opens a JSON-lines file that receives the engine counters after every move
+bool ConsoleGame::setStatsLog(const string& path) {
+#if CHESS_ENABLE_STATS
+    statsLog.open(path, ios::out | ios::app);
+    return statsLog.is_open();
+#else
+    (void)path;
+    return false;
+#endif
+}
+
+// This function prints the 8x8 board based on the board array
+void ConsoleGame::printBoard() {
+    clearScreen();
+
+    cout << "   Captured by White: "; for (char p : game.capturedBy(true)) cout << getPieceVisual(p) << " "; cout << endl;
+    cout << "     +--------------------------------+" << endl;
+
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        cout << "   " << (8 - i) << " |";
+        // This loop iterates 8 times (j=0 to 7), printing files a to h
+        for (int j = 0; j < BOARD_SIZE; ++j) {
+            string bg_color = "", fg_color = "";
+            if (USE_ANSI_COLORS) {
+                bool isLight = (i + j) % 2 == 0;
+                bg_color = isLight ? ANSI_BG_LIGHT : ANSI_BG_DARK;
+                // Use black text on light squares, white text on dark squares
+                fg_color = isLight ? ANSI_FG_BLACK : ANSI_FG_WHITE;
+                cout << bg_color << fg_color;
+            }
+            // Ensure consistent spacing
+             string pieceStr = getPieceVisual(game.getPieceAt(i, j));
+             string padding_before = " ";
+             string padding_after = (pieceStr.length() > 1 || pieceStr == " ") ? " " : "  ";
+             cout << padding_before << pieceStr << padding_after;
+
+            if (USE_ANSI_COLORS) cout << ANSI_RESET;
+        }
+        cout << "| " << (8 - i);
+
+        if (i == 0) cout << "    Last Move: " << game.getLastMoveNotation();
+        if (i == 2) {
+            cout << "    >>> " << (game.whiteToMove() ? "White" : "Black") << "'s Turn";
+            if (!twoPlayer) cout << (game.whiteToMove() ? " (You)" : " (AI)");
+            if (game.isKingInCheck(game.whiteToMove())) { cout << " (CHECK!)"; }
+        }
+        bool humanToMove = twoPlayer || game.whiteToMove();
+        if (i == 4 && humanToMove) cout << "    Enter move below";
+        if (i == 5 && humanToMove) cout << "    (e.g., e2e4)";
+        if (i == 4 && !humanToMove) cout << "    AI is thinking...";
+        cout << endl;
+    } // End row loop
+
+    cout << "     +--------------------------------+" << endl;
+    cout << "       a   b   c   d   e   f   g   h" << endl; // File letters
+    cout << "   Captured by Black: "; for (char p : game.capturedBy(false)) cout << getPieceVisual(p) << " "; cout << endl;
+
+    // Legend (Unchanged)
+    cout << "----------- Legend -----------" << endl;
+    if (USE_UNICODE_SYMBOLS) { cout << " White: P"<<getPieceVisual('P')<<" R"<<getPieceVisual('R')<<" N"<<getPieceVisual('N')<<" B"<<getPieceVisual('B')<<" Q"<<getPieceVisual('Q')<<" K"<<getPieceVisual('K') << endl << " Black: p"<<getPieceVisual('p')<<" r"<<getPieceVisual('r')<<" n"<<getPieceVisual('n')<<" b"<<getPieceVisual('b')<<" q"<<getPieceVisual('q')<<" k"<<getPieceVisual('k') << endl; }
+    else { cout << " White: P=Pawn R=Rook N=Knight B=Bishop Q=Queen K=King" << endl << " Black: p=Pawn r=Rook n=Knight b=Bishop q=Queen k=King" << endl; }
+    cout << "   " << (USE_UNICODE_SYMBOLS ? "' '" : ".") << " = Empty Square" << endl;
+    cout << "-----------------------------" << endl;
+}
+
+void ConsoleGame::play() {
+     string input; string errorMsg = ""; string infoMsg = "";
+     bool gameOver = false;
+     GameResult result = RESULT_UNKNOWN;
+     Ponderer ponderer;
+     bool ponderHit = false; // The human played the move the ponderer is searching
+
+     while (!gameOver) {
+         EngineStats pendingStats = engineStats();
+         printBoard(); // Print the board at the start of the turn
+
+
+         if (!errorMsg.empty()) {
+             cout << " (!) Invalid Move: " << errorMsg << endl;
+             errorMsg = ""; // Clear error after displaying
+         }
+         if (!infoMsg.empty()) {
+             cout << infoMsg;
+             infoMsg = "";
+         }
+
+         // Check for game end conditions *before* asking for move
+         // (Check if the current player has any valid moves). This and the
+         // board drawing above are not part of anyone's move, so their work is
+         // kept out of the counters.
+         vector<Move> availableMoves = game.generateValidMoves();
+         engineStats() = pendingStats;
+         if (availableMoves.empty()) {
+             if (game.isKingInCheck(game.whiteToMove())) {
+                 cout << "CHECKMATE! " << playerName(!game.whiteToMove()) << " wins!" << endl;
+                 result = game.whiteToMove() ? RESULT_BLACK_WINS : RESULT_WHITE_WINS;
+             } else {
+                 cout << "STALEMATE! It's a draw." << endl;
+                 result = RESULT_DRAW;
+             }
+             gameOver = true;
+             break;
+         }
+
+
+         if (twoPlayer || game.whiteToMove()) { // Human Player's Turn
+             cout << " Enter move (e.g. e2e4), 'undo', 'redo', 'save', 'load', 'analyze', 'stats', 'resign', or 'exit': ";
+             bool pondering = ponderEnabled && !twoPlayer;
+             if (pondering) ponderer.start(game, predictedMove, aiOptions, tt);
+             cin >> input;
+             if (pondering) {
+                 // Only the move being pondered lets that search run on; any other input ends it
+                 int sr, sc, er, ec;
+                 bool expected = input.length() == 4 && game.notationToIndex(input.substr(0, 2), sr, sc) &&
+                                 game.notationToIndex(input.substr(2, 2), er, ec) && ponderer.isPondering(sr, sc, er, ec);
+                 if (!expected) ponderer.stop();
+             }
+
+             if (input == "exit") {
+                 cout << " Exiting game." << endl;
+                 gameOver = true;
+                 break;
+             }
+             if (input == "resign") {
+                 cout << playerName(game.whiteToMove()) << " resigns. " << playerName(!game.whiteToMove()) << " wins!" << endl;
+                 result = game.whiteToMove() ? RESULT_BLACK_WINS : RESULT_WHITE_WINS;
+                 gameOver = true;
+                 break;
+             }
+             if (input == "stats") {
+                 infoMsg = statsReport();
+                 continue;
+             }
+             if (input == "analyze") {
+                 AnalysisOptions options;
+                 options.multiPV = 3;
+                 // The search is on the user's behalf, not part of the next move:
+                 // its counters are shown here and the pending ones put back after
+                 EngineStats pending = engineStats();
+                 engineStats().reset();
+                 vector<AnalysisLine> lines = analyzePosition(game, options, &tt);
+                 EngineStats searchStats = engineStats();
+                 engineStats() = pending;
+                 infoMsg = string(" Best lines for ") + (game.whiteToMove() ? "White" : "Black") + " (depth " + to_string(options.depth) + "):\n";
+                 for (size_t i = 0; i < lines.size(); ++i) infoMsg += "   " + to_string(i + 1) + ". " + formatAnalysisLine(game, lines[i]) + "\n";
+#if CHESS_ENABLE_STATS
+                 ostringstream out;
+                 printEngineStats(out, "Analysis", searchStats);
+                 infoMsg += out.str();
+#else
+                 (void)searchStats;
+#endif
+                 continue;
+             }
+             if (input == "undo") {
+                 // Against the AI, take back its reply and your move so it's your turn again
+                 if (!game.undoMove()) { infoMsg = " Nothing to undo.\n"; continue; }
+                 if (!twoPlayer && !game.whiteToMove()) game.undoMove();
+                 continue;
+             }
+             if (input == "redo") {
+                 if (!game.redoMove()) { infoMsg = " Nothing to redo.\n"; continue; }
+                 if (!twoPlayer && !game.whiteToMove()) game.redoMove();
+                 continue;
+             }
+             if (input == "save") {
+                 string path; cin >> path;
+                 string saveError;
+                 if (game.saveGame(path, RESULT_UNKNOWN, saveError)) infoMsg = " Game appended to " + path + ".\n";
+                 else infoMsg = " (!) " + saveError + "\n";
+                 continue;
+             }
+             if (input == "load") {
+                 string path; size_t number = 0; cin >> path >> number;
+                 if (!cin) { cin.clear(); cin.ignore(numeric_limits<streamsize>::max(), '\n'); infoMsg = " Usage: load <file> <game number>\n"; continue; }
+                 GameRecordReader reader; string loadError;
+                 if (!reader.open(path, loadError)) { infoMsg = " (!) " + loadError + "\n"; continue; }
+                 if (reader.partialTailBytes() > 0) {
+                     infoMsg = " (!) " + path + " ends in a partial game (" + to_string(reader.partialTailBytes()) + " bytes), which is skipped.\n";
+                 }
+                 if (number < 1 || number > reader.gameCount()) {
+                     infoMsg += " (!) " + path + " holds " + to_string(reader.gameCount()) + " games.\n"; continue;
+                 }
+                 if (game.loadGame(reader.game(number - 1), loadError)) {
+                     resetStats();
+                     infoMsg += " Loaded game " + to_string(number) + "; use 'undo'/'redo' to step through it.\n";
+                 } else {
+                     infoMsg += " (!) " + loadError + "\n";
+                 }
+                 continue;
+             }
+             if (input.length() != 4) {
+                 errorMsg = "Input must be 4 chars (e.g., e2e4).";
+                 cin.clear(); cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                 continue;
+             }
+
+             int startR, startC, endR, endC;
+             string startN = input.substr(0, 2);
+             string endN = input.substr(2, 2);
+
+             if (!game.notationToIndex(startN, startR, startC)) {
+                 errorMsg = "Invalid start square notation: '" + startN + "'.";
+                 continue;
+             }
+             if (!game.notationToIndex(endN, endR, endC)) {
+                 errorMsg = "Invalid end square notation: '" + endN + "'.";
+                 continue;
+             }
+
+             if (game.isMoveValid(startR, startC, endR, endC, errorMsg)) {
+                 bool moverIsWhite = game.whiteToMove();
+                 if (pondering) {
+                     ponderHit = ponderer.isPondering(startR, startC, endR, endC);
+                     if (ponderHit) ++ponderHits; else ++ponderMisses;
+                 }
+                 game.makeMove(startR, startC, endR, endC);
+                 recordMoveStats(moverIsWhite);
+             } else {
+                 cin.clear(); cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                 continue;
+             }
+
+         } else { // AI Player's Turn (Black)
+            chrono::steady_clock::time_point thinkStart = chrono::steady_clock::now();
+            vector<AnalysisLine> lines;
+            // On a ponder hit this position has been searched since the human
+            // started typing; only the rest of that search is waited for here
+            if (ponderHit) lines = ponderer.finish();
+            ponderHit = false;
+            if (lines.empty()) lines = analyzePosition(game, aiOptions, &tt);
+
+            // Keep "AI is thinking..." on screen for at least AI_THINKING_MS,
+            // however the move was found
+            chrono::milliseconds thought = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - thinkStart);
+            if (thought.count() < AI_THINKING_MS) {
+                 this_thread::sleep_for(chrono::milliseconds(AI_THINKING_MS) - thought);
+            }
+
+            if (lines.empty()) {
+                // This case should be caught by the check at the start of the loop,
+                // but we keep it as a safeguard.
+                 if (game.isKingInCheck(false)) { // Check if Black King is in check
+                     cout << "CHECKMATE! White (You) wins!" << endl;
+                     result = RESULT_WHITE_WINS;
+                 } else {
+                     cout << "STALEMATE! It's a draw." << endl;
+                     result = RESULT_DRAW;
+                 }
+                 gameOver = true;
+                 break;
+            }
+            const AnalysisLine& best = lines[0];
+            game.makeMove(best.move.startR, best.move.startC, best.move.endR, best.move.endC);
+            // The line's next move is the reply the AI expects; ponder that one
+            predictedMove = best.pv.size() > 1 ? best.pv[1] : Move();
+            recordMoveStats(false);
+         }
+     } // End game loop
+
+
+     if (!recordPath.empty() && game.historySize() > 0) {
+         string saveError;
+         if (!game.saveGame(recordPath, result, saveError)) cout << " (!) " << saveError << endl;
+     }
+
+     if (gameOver) {
+         printBoard();
+         cout << "Game Over." << endl;
+     }
+}
@@ -0,0 +1,80 @@
+#ifndef CONSOLE_GAME_HPP
+#define CONSOLE_GAME_HPP
+
+#include <fstream>  // For the per-move stats log
+#include <string>
+#include <vector>
+
+#include "Analysis.hpp"
+#include "ChessGame.hpp"
+#include "EngineStats.hpp"
+
+// --- Configuration ---
+const bool USE_UNICODE_SYMBOLS = true;
+const bool USE_ANSI_COLORS = true;
+const int AI_THINKING_MS = 500;
+// --- ANSI Color Codes ---
+const std::string ANSI_RESET = "\033[0m";
+const std::string ANSI_BG_LIGHT = "\033[47m";
+const std::string ANSI_BG_DARK = "\033[100m";
+const std::string ANSI_FG_BLACK = "\033[30m";
+const std::string ANSI_FG_WHITE = "\033[97m";
+
+// --- Helper Functions ---
+
+std::string getPieceVisual(char piece);
+
+// --- ConsoleGame Class ---
+// Interactive terminal front-end: draws the board, reads commands and lets a
+// human play the AI (or another human) on top of a ChessGame.
+class ConsoleGame {
+private:
+    ChessGame game;
+
+    // --- AI ---
+    TranspositionTable tt;      // Shared by the AI's searches and the ponderer
+    AnalysisOptions aiOptions;  // How deep the AI searches for its moves
+    Move predictedMove;         // Human reply the AI's last search expects; pondered next
+
+    // --- Instrumentation ---
+    // Work done for each ply, indexed like the game's history; entries past
+    // the history cursor belong to undone moves and come back with a redo
+    std::vector<EngineStats> plyStats;
+    std::ofstream statsLog;     // Optional JSON-lines log, one object per move
+    std::string recordPath;     // Finished games are appended here when set
+    bool twoPlayer = false;     // Both sides are human; otherwise the AI plays Black
+    bool ponderEnabled = false; // Think on the human's time in play()
+    int ponderHits = 0, ponderMisses = 0;
+
+    // --- Basic Helpers ---
+    void clearScreen();
+    // How play() addresses a side, e.g. "White (You)" against the AI
+    std::string playerName(bool white) const;
+
+    // --- Instrumentation Helpers ---
+    void resetStats();
+    void recordMoveStats(bool moverWasWhite);
+    std::string statsReport() const;
+
+public:
+    ConsoleGame();
+
+    // Opens a JSON-lines file that receives the engine counters after every move
+    bool setStatsLog(const std::string& path);
+    // Every game finished in play() is appended to this record file
+    void setRecordFile(const std::string& path) { recordPath = path; }
+    // Lets the AI search its reply to the expected human move while the
+    // human is typing; a hit leaves it only the rest of that search to do
+    void setPondering(bool enabled) { ponderEnabled = enabled; }
+    // Two humans share the keyboard instead of playing against the AI
+    void setTwoPlayer(bool enabled) { twoPlayer = enabled; }
+    bool isTwoPlayer() const { return twoPlayer; }
+
+    // This function prints the 8x8 board based on the board array
+    void printBoard();
+
+    // Main game loop
+    void play();
+};
+
+#endif // CONSOLE_GAME_HPP
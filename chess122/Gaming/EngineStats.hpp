@@ -0,0 +1,107 @@
+#ifndef ENGINE_STATS_HPP
+#define ENGINE_STATS_HPP
+
+#include <chrono>
+#include <ostream>
+#include <string>
+
+// --- Build Switch ---
+// Counters are on in debug builds and compiled out entirely when NDEBUG is
+// defined, so release builds pay nothing for them. Define CHESS_ENABLE_STATS
+// to 0 or 1 on the compiler command line to override.
+#ifndef CHESS_ENABLE_STATS
+    #ifdef NDEBUG
+        #define CHESS_ENABLE_STATS 0
+    #else
+        #define CHESS_ENABLE_STATS 1
+    #endif
+#endif
+
+// --- Counters collected while the engine works on a position ---
+struct EngineStats {
+    unsigned long long nodes = 0;          // Positions whose move list was generated
+    unsigned long long movesTried = 0;     // (from, to) pairs handed to isMoveValid
+    unsigned long long legalMoves = 0;     // Moves that passed validation
+    unsigned long long attackProbes = 0;   // isSquareAttacked calls
+    unsigned long long qnodes = 0;         // Quiescence search nodes
+    unsigned long long ttProbes = 0;       // Transposition table lookups
+    unsigned long long ttHits = 0;         // Lookups that found the position
+    unsigned long long ttCutoffs = 0;      // Hits whose stored bound ended the node
+    unsigned long long betaCutoffs = 0;    // Nodes that failed high
+    unsigned long long firstMoveCutoffs = 0; // ...on the first move searched
+    unsigned long long generationNs = 0;   // Wall time inside generateValidMoves
+    unsigned long long validationNs = 0;   // ...of which in its loop validating and scoring every from/to pair
+    unsigned long long evaluationNs = 0;   // Wall time inside evaluate()
+
+    // Average number of legal moves per generated position
+    double branchingFactor() const { return nodes ? double(legalMoves) / double(nodes) : 0.0; }
+    // Share of fail-high nodes where move ordering put the refutation first
+    double firstMoveCutoffRate() const { return betaCutoffs ? double(firstMoveCutoffs) / double(betaCutoffs) : 0.0; }
+
+    void reset() { *this = EngineStats(); }
+
+    EngineStats& operator+=(const EngineStats& o) {
+        nodes += o.nodes; movesTried += o.movesTried; legalMoves += o.legalMoves; attackProbes += o.attackProbes;
+        qnodes += o.qnodes; ttProbes += o.ttProbes; ttHits += o.ttHits; ttCutoffs += o.ttCutoffs;
+        betaCutoffs += o.betaCutoffs; firstMoveCutoffs += o.firstMoveCutoffs;
+        generationNs += o.generationNs; validationNs += o.validationNs; evaluationNs += o.evaluationNs;
+        return *this;
+    }
+};
+
+// Each thread counts into its own instance, so no synchronisation is needed.
+inline EngineStats& engineStats() {
+    static thread_local EngineStats stats;
+    return stats;
+}
+
+// Adds the lifetime of the enclosing scope to an EngineStats timer field
+class ScopedStatTimer {
+public:
+    explicit ScopedStatTimer(unsigned long long& target)
+        : target(target), start(std::chrono::steady_clock::now()) {}
+    ~ScopedStatTimer() {
+        target += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+    ScopedStatTimer(const ScopedStatTimer&) = delete;
+    ScopedStatTimer& operator=(const ScopedStatTimer&) = delete;
+private:
+    unsigned long long& target;
+    std::chrono::steady_clock::time_point start;
+};
+
+#if CHESS_ENABLE_STATS
+    #define STATS_INC(field) (++engineStats().field)
+    #define STATS_TIMER(field) ScopedStatTimer statTimer_##field(engineStats().field)
+#else
+    #define STATS_INC(field) ((void)0)
+    #define STATS_TIMER(field) ((void)0)
+#endif
+
+// --- Reporting ---
+
+// Human readable summary for the 'stats' command
+inline void printEngineStats(std::ostream& out, const std::string& title, const EngineStats& s) {
+    out << " " << title << ":" << std::endl;
+    out << "   Nodes: " << s.nodes << "   Moves tried: " << s.movesTried << "   Legal: " << s.legalMoves
+        << "   Branching factor: " << s.branchingFactor() << std::endl;
+    out << "   Attack probes: " << s.attackProbes << "   Quiescence nodes: " << s.qnodes << std::endl;
+    out << "   TT probes: " << s.ttProbes << "   hits: " << s.ttHits << "   cutoffs: " << s.ttCutoffs
+        << "   Beta cutoffs: " << s.betaCutoffs << " (" << s.firstMoveCutoffRate() * 100.0 << "% on first move)" << std::endl;
+    out << "   Time (us) - generation: " << s.generationNs / 1000 << "  validation: " << s.validationNs / 1000
+        << "  evaluation: " << s.evaluationNs / 1000 << std::endl;
+}
+
+// One JSON object per line, for the optional per-move log
+inline void writeEngineStatsJson(std::ostream& out, int ply, const std::string& side, const std::string& move, const EngineStats& s) {
+    out << "{\"ply\":" << ply << ",\"side\":\"" << side << "\",\"move\":\"" << move << "\""
+        << ",\"nodes\":" << s.nodes << ",\"moves_tried\":" << s.movesTried << ",\"legal_moves\":" << s.legalMoves
+        << ",\"branching_factor\":" << s.branchingFactor() << ",\"attack_probes\":" << s.attackProbes
+        << ",\"qnodes\":" << s.qnodes << ",\"tt_probes\":" << s.ttProbes << ",\"tt_hits\":" << s.ttHits
+        << ",\"tt_cutoffs\":" << s.ttCutoffs << ",\"beta_cutoffs\":" << s.betaCutoffs
+        << ",\"first_move_cutoff_rate\":" << s.firstMoveCutoffRate()
+        << ",\"generation_ns\":" << s.generationNs << ",\"validation_ns\":" << s.validationNs
+        << ",\"evaluation_ns\":" << s.evaluationNs << "}" << std::endl;
+}
+
+#endif // ENGINE_STATS_HPP
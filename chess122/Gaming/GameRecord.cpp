@@ -0,0 +1,158 @@
+#include "GameRecord.hpp"
+
+#include <cstring>
+#include <filesystem> // For resize_file
+#include <fstream>
+#include <iterator> // For istreambuf_iterator
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+const char RECORD_MAGIC[4] = {'C', 'G', 'R', '1'};
+const size_t GAME_HEADER_SIZE = 6;
+
+void putU16(string& out, unsigned v) { out += char(v & 0xFF); out += char((v >> 8) & 0xFF); }
+void putU32(string& out, uint32_t v) { for (int i = 0; i < 4; ++i) out += char((v >> (8 * i)) & 0xFF); }
+uint32_t getU32(const unsigned char* p) { return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24); }
+
+} // namespace
+
+// --- Writing ---
+
+bool appendGameRecord(const string& path, const string& startFen, const vector<PackedMove>& moves,
+                      GameResult result, string& errorMsg) {
+    errorMsg = "";
+    if (startFen.size() > 255) { errorMsg = "Starting FEN is too long for a game record."; return false; }
+
+    // Check the magic of an existing file so we never append to something else
+    bool isNew = true;
+    {
+        ifstream existing(path, ios::binary);
+        char magic[4];
+        if (existing) {
+            existing.read(magic, 4);
+            // Only a missing or empty file is new; anything else must start with the magic
+            if (existing.gcount() > 0) {
+                isNew = false;
+                if (existing.gcount() < 4 || memcmp(magic, RECORD_MAGIC, 4) != 0) {
+                    errorMsg = "'" + path + "' is not a game record file."; return false;
+                }
+            }
+        }
+    }
+
+    // Appending after a torn game would make every later game unreadable, so
+    // cut the file back to its last whole game first
+    if (!isNew) {
+        size_t completeLength = 0, tail = 0;
+        {
+            GameRecordReader reader;
+            if (!reader.open(path, errorMsg)) return false;
+            completeLength = reader.completeLength();
+            tail = reader.partialTailBytes();
+        }
+        if (tail > 0) {
+            error_code ec;
+            filesystem::resize_file(path, completeLength, ec);
+            if (ec) { errorMsg = "Cannot remove the partial game at the end of '" + path + "'."; return false; }
+        }
+    }
+
+    // Build the whole game first so it lands with a single write
+    string bytes;
+    bytes.reserve(4 + GAME_HEADER_SIZE + startFen.size() + 2 * moves.size());
+    if (isNew) bytes.append(RECORD_MAGIC, 4);
+    putU32(bytes, uint32_t(moves.size()));
+    bytes += char(result);
+    bytes += char(startFen.size());
+    bytes += startFen;
+    for (PackedMove m : moves) putU16(bytes, m);
+
+    ofstream out(path, ios::binary | ios::app);
+    if (!out) { errorMsg = "Cannot open '" + path + "' for writing."; return false; }
+    out.write(bytes.data(), bytes.size());
+    if (!out) { errorMsg = "Failed to write to '" + path + "'."; return false; }
+    return true;
+}
+
+// --- Reading ---
+
+void GameRecordReader::close() {
+#ifndef _WIN32
+    if (mapped && data) munmap(const_cast<unsigned char*>(data), length);
+#endif
+    data = nullptr; length = 0; completeEnd = 0; mapped = false;
+    buffer.clear(); gameOffsets.clear();
+}
+
+bool GameRecordReader::open(const string& path, string& errorMsg) {
+    errorMsg = "";
+    close();
+
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) { errorMsg = "Cannot open '" + path + "'."; return false; }
+    struct stat st;
+    if (fstat(fd, &st) != 0) { ::close(fd); errorMsg = "Cannot read '" + path + "'."; return false; }
+    length = size_t(st.st_size);
+    if (length > 0) {
+        void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) { ::close(fd); length = 0; errorMsg = "Cannot map '" + path + "'."; return false; }
+        data = static_cast<const unsigned char*>(p);
+        mapped = true;
+    }
+    ::close(fd);
+#else
+    ifstream in(path, ios::binary);
+    if (!in) { errorMsg = "Cannot open '" + path + "'."; return false; }
+    buffer.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+    data = buffer.data(); length = buffer.size();
+#endif
+
+    if (length < 4 || memcmp(data, RECORD_MAGIC, 4) != 0) {
+        close(); errorMsg = "'" + path + "' is not a game record file."; return false;
+    }
+
+    // Hop from header to header; each game's size follows from its header.
+    // Whatever does not hold a whole game at the end is a torn append: it is
+    // left out of the index rather than costing the games before it.
+    size_t pos = 4;
+    while (length - pos >= GAME_HEADER_SIZE) {
+        size_t plies = getU32(data + pos);
+        size_t fenLength = data[pos + 5];
+        size_t gameSize = GAME_HEADER_SIZE + fenLength + 2 * plies;
+        if (length - pos < gameSize) break;
+
+        // A whole game with impossible contents means the file is damaged
+        string where = "game " + to_string(gameOffsets.size() + 1) + " of '" + path + "'";
+        if (data[pos + 4] > RESULT_DRAW) { close(); errorMsg = "Invalid result in " + where + "."; return false; }
+        const unsigned char* moves = data + pos + GAME_HEADER_SIZE + fenLength;
+        for (size_t i = 0; i < plies; ++i) {
+            if (moves[2 * i + 1] & 0xF0) { close(); errorMsg = "Invalid move in " + where + "."; return false; }
+        }
+
+        gameOffsets.push_back(pos);
+        pos += gameSize;
+    }
+    completeEnd = pos;
+    return true;
+}
+
+GameView GameRecordReader::game(size_t index) const {
+    GameView view;
+    const unsigned char* p = data + gameOffsets[index];
+    view.plyCount = getU32(p);
+    view.result = GameResult(p[4]);
+    size_t fenLength = p[5];
+    view.startFen.assign(reinterpret_cast<const char*>(p + GAME_HEADER_SIZE), fenLength);
+    view.moveData = p + GAME_HEADER_SIZE + fenLength;
+    return view;
+}
@@ -0,0 +1,80 @@
+#ifndef GAME_RECORD_HPP
+#define GAME_RECORD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "MoveHistory.hpp"
+
+// --- Binary Game Record Format ---
+// A record file starts with the 4 byte magic "CGR1" followed by games that
+// are only ever appended. Each game is stored as (all integers little endian):
+//
+//   uint32  ply count
+//   uint8   result (GameResult)
+//   uint8   length of the starting FEN, 0 for the standard start position
+//   char[]  starting FEN
+//   uint16  packed move, once per ply
+//
+// The layout has no padding or pointers, so a reader can map the file and
+// walk it in place. Moves use bits 0-11 only. An append cut short (crash,
+// full disk) leaves a partial game at the end: readers skip it and the next
+// append truncates it away.
+
+enum GameResult : std::uint8_t {
+    RESULT_UNKNOWN = 0,
+    RESULT_WHITE_WINS = 1,
+    RESULT_BLACK_WINS = 2,
+    RESULT_DRAW = 3
+};
+
+// Appends one game to the record file at path, creating it if needed. A
+// partial game left at the end by an earlier failed append is removed first.
+bool appendGameRecord(const std::string& path, const std::string& startFen, const std::vector<PackedMove>& moves,
+                      GameResult result, std::string& errorMsg);
+
+// One game inside a mapped record file; only valid while its reader is open
+struct GameView {
+    std::string startFen;      // Empty for the standard start position
+    GameResult result = RESULT_UNKNOWN;
+    std::uint32_t plyCount = 0;
+    const unsigned char* moveData = nullptr;
+
+    PackedMove move(std::size_t ply) const {
+        return PackedMove(moveData[2 * ply] | (moveData[2 * ply + 1] << 8));
+    }
+};
+
+// Read-only view of a record file. On POSIX systems the file is memory
+// mapped; elsewhere it is read into memory once. Opening indexes every game
+// so game(i) is a direct seek.
+class GameRecordReader {
+private:
+    const unsigned char* data = nullptr;
+    std::size_t length = 0;
+    std::vector<unsigned char> buffer;  // Backing storage when not mapped
+    bool mapped = false;
+    std::vector<std::size_t> gameOffsets;
+    std::size_t completeEnd = 0;        // Just past the last whole game
+
+    void close();
+
+public:
+    GameRecordReader() = default;
+    ~GameRecordReader() { close(); }
+    GameRecordReader(const GameRecordReader&) = delete;
+    GameRecordReader& operator=(const GameRecordReader&) = delete;
+
+    bool open(const std::string& path, std::string& errorMsg);
+
+    std::size_t gameCount() const { return gameOffsets.size(); }
+    // Length of the file up to the end of its last whole game, and the bytes
+    // of a partial game after that (left by a torn append), which are ignored
+    std::size_t completeLength() const { return completeEnd; }
+    std::size_t partialTailBytes() const { return length - completeEnd; }
+    GameView game(std::size_t index) const;
+};
+
+#endif // GAME_RECORD_HPP
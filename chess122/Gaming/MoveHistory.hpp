@@ -0,0 +1,71 @@
+#ifndef MOVE_HISTORY_HPP
+#define MOVE_HISTORY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// --- Packed Moves ---
+// A move fits in 16 bits: bits 0-5 hold the start square, bits 6-11 the end
+// square (square = row * 8 + col, row 0 is rank 8) and bits 12-15 are kept
+// free for flags such as promotion once those rules exist.
+typedef std::uint16_t PackedMove;
+
+inline PackedMove packMove(int startR, int startC, int endR, int endC) {
+    return PackedMove((startR * 8 + startC) | ((endR * 8 + endC) << 6));
+}
+
+inline void unpackMove(PackedMove m, int& startR, int& startC, int& endR, int& endC) {
+    int from = m & 63, to = (m >> 6) & 63;
+    startR = from / 8; startC = from % 8;
+    endR = to / 8; endC = to % 8;
+}
+
+// --- Undo Record ---
+// Everything needed to take a move back besides the move itself: the piece
+// that stood on the end square ('.' when the move was not a capture).
+struct UndoRecord {
+    PackedMove move;
+    char captured;
+};
+
+// --- Undo/Redo History ---
+// Played moves sit before the cursor, undone moves after it. Undo and redo
+// just move the cursor; recording a new move drops whatever was undone.
+class MoveHistory {
+private:
+    std::vector<UndoRecord> records;
+    std::size_t cursor = 0;
+
+public:
+    void record(const UndoRecord& rec) {
+        records.resize(cursor);
+        records.push_back(rec);
+        ++cursor;
+    }
+
+    bool canUndo() const { return cursor > 0; }
+    bool canRedo() const { return cursor < records.size(); }
+
+    // Steps back over the last played move and returns it
+    const UndoRecord& undo() { return records[--cursor]; }
+    // Steps forward over the next undone move and returns it
+    const UndoRecord& redo() { return records[cursor++]; }
+
+    // Most recent played move; only valid while canUndo()
+    const UndoRecord& last() const { return records[cursor - 1]; }
+
+    std::size_t size() const { return cursor; }
+
+    // The played moves in order, as stored in game records
+    std::vector<PackedMove> playedMoves() const {
+        std::vector<PackedMove> moves;
+        moves.reserve(cursor);
+        for (std::size_t i = 0; i < cursor; ++i) moves.push_back(records[i].move);
+        return moves;
+    }
+
+    void clear() { records.clear(); cursor = 0; }
+};
+
+#endif // MOVE_HISTORY_HPP
@@ -0,0 +1,45 @@
+#include "Ponder.hpp"
+
+using namespace std;
+
+void Ponderer::start(const ChessGame& position, const Move& prediction, const AnalysisOptions& options, TranspositionTable& tt) {
+    stop();
+    lines.clear();
+    abortFlag = false;
+
+    ChessGame child = position;
+    expected = prediction;
+    if (expected.startR < 0 || !child.isMoveValid(expected.startR, expected.startC, expected.endR, expected.endC)) {
+        AnalysisOptions guess;
+        guess.depth = 1;
+        vector<AnalysisLine> best = analyzePosition(child, guess, &tt);
+        if (best.empty()) { expected = Move(); return; } // Game over; nothing to ponder
+        expected = best[0].move;
+    }
+    child.makeMove(expected.startR, expected.startC, expected.endR, expected.endC);
+
+    AnalysisOptions search = options;
+    search.stop = &abortFlag;
+    worker = thread(&Ponderer::run, this, child, search, &tt);
+}
+
+void Ponderer::stop() {
+    abortFlag = true;
+    if (worker.joinable()) worker.join();
+    expected = Move();
+}
+
+bool Ponderer::isPondering(int startR, int startC, int endR, int endC) const {
+    return worker.joinable() && expected.startR == startR && expected.startC == startC &&
+           expected.endR == endR && expected.endC == endC;
+}
+
+vector<AnalysisLine> Ponderer::finish() {
+    if (worker.joinable()) worker.join();
+    expected = Move();
+    return lines;
+}
+
+void Ponderer::run(ChessGame position, AnalysisOptions options, TranspositionTable* tt) {
+    lines = analyzePosition(position, options, tt);
+}
@@ -0,0 +1,45 @@
+#ifndef PONDER_HPP
+#define PONDER_HPP
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Analysis.hpp"
+#include "ChessGame.hpp"
+
+// --- Pondering ---
+// Thinks on the opponent's time: while the human is typing, a background
+// thread plays the move the human is expected to make on its own copy of
+// the position and searches the AI's answer into the AI's transposition
+// table. If the human plays that move (a ponder hit) the search runs on and
+// finish() hands over its result; any other input aborts it. Either way the
+// table keeps everything the search completed.
+class Ponderer {
+private:
+    std::thread worker;
+    std::atomic<bool> abortFlag{false};
+    Move expected;                      // Human move being pondered; startR < 0 when none
+    std::vector<AnalysisLine> lines;    // AI's answer to it. Only touched by the worker until it is joined.
+
+    void run(ChessGame position, AnalysisOptions options, TranspositionTable* tt);
+
+public:
+    Ponderer() = default;
+    ~Ponderer() { stop(); }
+    Ponderer(const Ponderer&) = delete;
+    Ponderer& operator=(const Ponderer&) = delete;
+
+    // Starts pondering the given position (the human is to move). prediction
+    // is the human move the AI's last search expected; when it is missing or
+    // no longer legal, a shallow search picks the likeliest move instead.
+    void start(const ChessGame& position, const Move& prediction, const AnalysisOptions& options, TranspositionTable& tt);
+    // Aborts the search and waits for the worker
+    void stop();
+    // The move being pondered, if the search is still running
+    bool isPondering(int startR, int startC, int endR, int endC) const;
+    // Waits for the search of the pondered move to end and returns its lines
+    std::vector<AnalysisLine> finish();
+};
+
+#endif // PONDER_HPP
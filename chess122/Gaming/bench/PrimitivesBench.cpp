@@ -0,0 +1,170 @@
+// Microbenchmarks for the ChessGame hot paths.
+//
+// Every benchmark runs once per position of a fixed corpus so results can be
+// compared between runs and machines. The CMake build produces it as the
+// chess_bench target when Google Benchmark is installed; use a Release build
+// so the engine counters are compiled out, and ask for machine-readable output:
+//
+//   ./chess_bench --benchmark_format=json --benchmark_out=bench.json
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "Analysis.hpp"
+#include "ChessGame.hpp"
+
+using namespace std;
+
+namespace {
+
+// --- Position Corpus ---
+struct BenchPosition {
+    const char* name;
+    const char* fen;
+};
+
+const BenchPosition CORPUS[] = {
+    {"start",         "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w - - 0 1"},
+    {"italian",       "r1bqk2r/pppp1ppp/2n2n2/2b1p3/2B1P3/2NP1N2/PPP2PPP/R1BQK2R b - - 0 5"},
+    {"middlegame",    "r2q1rk1/pp2bppp/2n1pn2/3p4/2PP4/2N1PN2/PP2BPPP/R2Q1RK1 w - - 0 10"},
+    {"open_tactics",  "r1b2rk1/2q1bppp/p2ppn2/1p6/3NP3/1BN1B3/PPP1QPPP/R4RK1 w - - 0 12"},
+    {"rook_endgame",  "8/5pk1/6p1/3R4/r7/6P1/5PK1/8 w - - 0 40"},
+    {"pawn_endgame",  "8/8/4k3/3p1p2/3P1P2/4K3/8/8 w - - 0 50"},
+    {"queen_endgame", "6k1/5p2/6p1/8/3Q4/6P1/q4PK1/8 b - - 0 45"},
+};
+const int CORPUS_SIZE = sizeof(CORPUS) / sizeof(CORPUS[0]);
+
+ChessGame loadPosition(benchmark::State& state) {
+    const BenchPosition& pos = CORPUS[state.range(0)];
+    state.SetLabel(pos.name);
+    ChessGame game;
+    string error;
+    if (!game.loadFEN(pos.fen, error)) state.SkipWithError(error.c_str());
+    return game;
+}
+
+void corpusArgs(benchmark::internal::Benchmark* b) { b->DenseRange(0, CORPUS_SIZE - 1); }
+
+// --- Benchmarks ---
+
+void BM_IsSquareAttacked(benchmark::State& state) {
+    ChessGame game = loadPosition(state);
+    for (auto _ : state) {
+        for (int r = 0; r < BOARD_SIZE; ++r)
+            for (int c = 0; c < BOARD_SIZE; ++c) {
+                benchmark::DoNotOptimize(game.isSquareAttacked(r, c, true));
+                benchmark::DoNotOptimize(game.isSquareAttacked(r, c, false));
+            }
+    }
+    state.SetItemsProcessed(state.iterations() * BOARD_SIZE * BOARD_SIZE * 2);
+}
+BENCHMARK(BM_IsSquareAttacked)->Apply(corpusArgs);
+
+// All from/to pairs starting on a piece of the side to move, as generateValidMoves tries them
+void BM_IsMoveValid(benchmark::State& state) {
+    ChessGame game = loadPosition(state);
+    vector<Move> candidates;
+    for (int r = 0; r < BOARD_SIZE; ++r)
+        for (int c = 0; c < BOARD_SIZE; ++c) {
+            char p = game.getPieceAt(r, c);
+            if (game.whiteToMove() ? !game.isPieceWhite(p) : !game.isPieceBlack(p)) continue;
+            for (int er = 0; er < BOARD_SIZE; ++er)
+                for (int ec = 0; ec < BOARD_SIZE; ++ec) candidates.push_back(Move(r, c, er, ec));
+        }
+    for (auto _ : state) {
+        for (const Move& m : candidates) benchmark::DoNotOptimize(game.isMoveValid(m.startR, m.startC, m.endR, m.endC));
+    }
+    state.SetItemsProcessed(state.iterations() * candidates.size());
+}
+BENCHMARK(BM_IsMoveValid)->Apply(corpusArgs);
+
+void BM_MoveLeavesKingInCheck(benchmark::State& state) {
+    ChessGame game = loadPosition(state);
+    vector<Move> moves = game.generateValidMoves();
+    for (auto _ : state) {
+        for (const Move& m : moves) benchmark::DoNotOptimize(game.moveLeavesKingInCheck(m.startR, m.startC, m.endR, m.endC));
+    }
+    state.SetItemsProcessed(state.iterations() * moves.size());
+}
+BENCHMARK(BM_MoveLeavesKingInCheck)->Apply(corpusArgs);
+
+void BM_GenerateValidMoves(benchmark::State& state) {
+    ChessGame game = loadPosition(state);
+    for (auto _ : state) {
+        vector<Move> moves = game.generateValidMoves();
+        benchmark::DoNotOptimize(moves.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GenerateValidMoves)->Apply(corpusArgs);
+
+// What analyzePosition and the ponderer pay to search a private copy
+void BM_CopyGame(benchmark::State& state) {
+    ChessGame game = loadPosition(state);
+    for (auto _ : state) {
+        ChessGame copy = game;
+        benchmark::DoNotOptimize(&copy);
+    }
+}
+BENCHMARK(BM_CopyGame)->Apply(corpusArgs);
+
+// One makeMove/undoMove pair per iteration on the same game, cycling through the legal moves
+void BM_MakeUndoMove(benchmark::State& state) {
+    ChessGame game = loadPosition(state);
+    vector<Move> moves = game.generateValidMoves();
+    size_t i = 0;
+    for (auto _ : state) {
+        const Move& m = moves[i++ % moves.size()];
+        game.makeMove(m.startR, m.startC, m.endR, m.endC);
+        game.undoMove();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MakeUndoMove)->Apply(corpusArgs);
+
+void BM_Evaluate(benchmark::State& state) {
+    ChessGame game = loadPosition(state);
+    for (auto _ : state) benchmark::DoNotOptimize(game.evaluate());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Evaluate)->Apply(corpusArgs);
+
+void BM_LoadFEN(benchmark::State& state) {
+    ChessGame game = loadPosition(state);
+    const string fen = CORPUS[state.range(0)].fen;
+    string error;
+    for (auto _ : state) benchmark::DoNotOptimize(game.loadFEN(fen, error));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LoadFEN)->Apply(corpusArgs);
+
+// Searches the whole corpus through analyzeBatch with a fresh shared table per
+// run. Arguments are the search depth and the thread count.
+void BM_AnalyzeBatch(benchmark::State& state) {
+    vector<ChessGame> positions;
+    for (const BenchPosition& pos : CORPUS) {
+        ChessGame game;
+        string error;
+        if (!game.loadFEN(pos.fen, error)) { state.SkipWithError(error.c_str()); return; }
+        positions.push_back(game);
+    }
+    AnalysisOptions options;
+    options.depth = int(state.range(0));
+    TranspositionTable tt;
+    for (auto _ : state) {
+        state.PauseTiming();
+        tt.clear();
+        state.ResumeTiming();
+        vector<vector<AnalysisLine>> results = analyzeBatch(positions, options, tt, unsigned(state.range(1)));
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(state.iterations() * positions.size());
+}
+BENCHMARK(BM_AnalyzeBatch)->Args({2, 1})->Args({3, 1})->Args({3, 4})->Unit(benchmark::kMillisecond)->UseRealTime();
+
+} // namespace
+
+BENCHMARK_MAIN();
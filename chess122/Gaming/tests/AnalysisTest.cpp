@@ -0,0 +1,184 @@
+// Checks of the analysis search: mates, multi-PV ordering, the caller's
+// position being left alone, batch search over a shared transposition table
+// and the table's own packing. Exits non-zero on the first failure.
+
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Analysis.hpp"
+#include "ChessGame.hpp"
+
+using namespace std;
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(cond) \
+    do { if (!(cond)) { cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: " #cond << endl; ++failures; } } while (0)
+
+const char* MATE_IN_ONE = "6k1/5ppp/8/8/8/8/5PPP/R5K1 w - - 0 1";
+
+ChessGame fromFen(const string& fen) {
+    ChessGame game;
+    string error;
+    bool ok = game.loadFEN(fen, error);
+    CHECK(ok);
+    if (!ok) cerr << "  " << fen << ": " << error << endl;
+    return game;
+}
+
+string moveText(const ChessGame& game, const Move& m) {
+    return game.indexToNotation(m.startR, m.startC) + game.indexToNotation(m.endR, m.endC);
+}
+
+void testFindsMateInOne() {
+    ChessGame game = fromFen(MATE_IN_ONE);
+    AnalysisOptions options;
+    options.depth = 3;
+    TranspositionTable tt(1);
+
+    // The second search runs on a table the first one filled, so mate scores
+    // must survive being stored relative to the node and read back
+    for (int pass = 0; pass < 2; ++pass) {
+        vector<AnalysisLine> lines = analyzePosition(game, options, &tt);
+        CHECK(!lines.empty());
+        if (lines.empty()) return;
+        CHECK(moveText(game, lines[0].move) == "a1a8");
+        CHECK(lines[0].score == MATE_SCORE - 1);
+        CHECK(formatAnalysisLine(game, lines[0]).substr(0, 2) == "#1");
+    }
+}
+
+void testMultiPV() {
+    ChessGame game = fromFen("r1bqk2r/pppp1ppp/2n2n2/2b1p3/2B1P3/2NP1N2/PPP2PPP/R1BQK2R b - - 0 5");
+    AnalysisOptions options;
+    options.depth = 2;
+    options.multiPV = 4;
+    vector<AnalysisLine> lines = analyzePosition(game, options);
+    CHECK(lines.size() == 4);
+
+    set<string> roots;
+    for (size_t i = 0; i < lines.size(); ++i) {
+        roots.insert(moveText(game, lines[i].move));
+        CHECK(!lines[i].pv.empty() && moveText(game, lines[i].pv[0]) == moveText(game, lines[i].move));
+        if (i > 0) CHECK(lines[i].score <= lines[i - 1].score);
+    }
+    CHECK(roots.size() == lines.size());
+
+    // Asking for more lines than there are moves returns every move once
+    ChessGame endgame = fromFen("8/8/4k3/3p1p2/3P1P2/4K3/8/8 w - - 0 50");
+    options.multiPV = 64;
+    CHECK(analyzePosition(endgame, options).size() == endgame.generateValidMoves().size());
+}
+
+void testLeavesPositionAlone() {
+    ChessGame game;
+    for (const char* m : {"e2e4", "e7e5", "g1f3"}) {
+        int sr, sc, er, ec;
+        game.notationToIndex(string(m, 2), sr, sc);
+        game.notationToIndex(string(m + 2, 2), er, ec);
+        game.makeMove(sr, sc, er, ec);
+    }
+    uint64_t hash = hashPosition(game);
+    size_t plies = game.historySize();
+    string last = game.getLastMoveNotation();
+
+    TranspositionTable tt(1);
+    AnalysisOptions options;
+    options.multiPV = 3;
+    analyzePosition(game, options, &tt);
+
+    CHECK(hashPosition(game) == hash);
+    CHECK(game.historySize() == plies);
+    CHECK(game.getLastMoveNotation() == last);
+    CHECK(!game.whiteToMove());
+}
+
+void testBatchMatchesSingleSearches() {
+    // Unrelated positions, so no search can reach another's positions
+    // through the shared table and change its result
+    const char* fens[] = {
+        MATE_IN_ONE,
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w - - 0 1",
+        "r2q1rk1/pp2bppp/2n1pn2/3p4/2PP4/2N1PN2/PP2BPPP/R2Q1RK1 w - - 0 10",
+        "8/5pk1/6p1/3R4/r7/6P1/5PK1/8 w - - 0 40",
+        "8/8/4k3/3p1p2/3P1P2/4K3/8/8 w - - 0 50",
+        "6k1/5p2/6p1/8/3Q4/6P1/q4PK1/8 b - - 0 45",
+    };
+    vector<ChessGame> positions;
+    for (const char* fen : fens) positions.push_back(fromFen(fen));
+
+    AnalysisOptions options;
+    options.depth = 2;
+    TranspositionTable shared(4);
+    vector<vector<AnalysisLine>> batch = analyzeBatch(positions, options, shared, 4);
+    CHECK(batch.size() == positions.size());
+    if (batch.size() != positions.size()) return;
+
+    for (size_t i = 0; i < positions.size(); ++i) {
+        TranspositionTable own(1);
+        vector<AnalysisLine> single = analyzePosition(positions[i], options, &own);
+        CHECK(!batch[i].empty() && !single.empty());
+        if (batch[i].empty() || single.empty()) continue;
+        if (batch[i][0].score != single[0].score) cerr << "  position " << i << ": " << batch[i][0].score << " vs " << single[0].score << endl;
+        CHECK(batch[i][0].score == single[0].score);
+    }
+}
+
+// A position where the side not to move is in check would let the search
+// capture a king, so loadFEN must refuse it and leave the game as it was
+void testRejectsKingInCheckOffTurn() {
+    ChessGame game = fromFen(MATE_IN_ONE);
+    uint64_t hash = hashPosition(game);
+    string error;
+    CHECK(!game.loadFEN("4k3/4R3/8/8/8/8/8/4K3 w - - 0 1", error));
+    CHECK(error == "Side not to move is in check.");
+    CHECK(hashPosition(game) == hash);
+    CHECK(game.loadFEN("4k3/4R3/8/8/8/8/8/4K3 b - - 0 1", error));
+}
+
+void testTableRoundTrip() {
+    TranspositionTable tt(1);
+    TranspositionTable::Entry entry;
+    const uint64_t key = 0x0123456789ABCDEFULL;
+    CHECK(!tt.probe(key, entry));
+
+    const int scores[] = {0, 7, -123, MATE_SCORE - 3, -(MATE_SCORE - 3), 32000, -32000};
+    for (int score : scores) {
+        PackedMove move = packMove(6, 4, 4, 4);
+        tt.store(key, move, score, 5, TranspositionTable::BOUND_LOWER);
+        CHECK(tt.probe(key, entry));
+        CHECK(entry.move == move);
+        CHECK(entry.score == score);
+        CHECK(entry.depth == 5);
+        CHECK(entry.bound == TranspositionTable::BOUND_LOWER);
+    }
+
+    // A different key in the same slot must not match
+    CHECK(!tt.probe(key ^ (uint64_t(1) << 63), entry));
+
+    tt.store(key, 0, -MATE_SCORE + 1, 0, TranspositionTable::BOUND_UPPER);
+    CHECK(tt.probe(key, entry));
+    CHECK(entry.move == 0 && entry.score == -MATE_SCORE + 1 && entry.depth == 0 && entry.bound == TranspositionTable::BOUND_UPPER);
+
+    tt.clear();
+    CHECK(!tt.probe(key, entry));
+}
+
+} // namespace
+
+int main() {
+    testFindsMateInOne();
+    testMultiPV();
+    testLeavesPositionAlone();
+    testBatchMatchesSingleSearches();
+    testRejectsKingInCheckOffTurn();
+    testTableRoundTrip();
+
+    if (failures) { cerr << failures << " check(s) failed" << endl; return 1; }
+    cout << "All analysis checks passed" << endl;
+    return 0;
+}
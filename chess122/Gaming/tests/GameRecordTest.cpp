@@ -0,0 +1,210 @@
+// Round trip of the binary game record format: appendGameRecord ->
+// GameRecordReader -> ChessGame::loadGame, plus the files a reader or
+// writer must refuse. Exits non-zero on the first failure.
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator> // For istreambuf_iterator
+#include <string>
+#include <vector>
+
+#include "ChessGame.hpp"
+#include "GameRecord.hpp"
+
+using namespace std;
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(cond) \
+    do { if (!(cond)) { cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: " #cond << endl; ++failures; } } while (0)
+
+// Plays "e2e4"-style moves; every one must be legal
+void play(ChessGame& game, const vector<string>& moves) {
+    for (const string& m : moves) {
+        int sr, sc, er, ec;
+        bool ok = game.notationToIndex(m.substr(0, 2), sr, sc) && game.notationToIndex(m.substr(2, 2), er, ec) &&
+                  game.isMoveValid(sr, sc, er, ec);
+        CHECK(ok);
+        if (ok) game.makeMove(sr, sc, er, ec);
+    }
+}
+
+bool samePosition(const ChessGame& a, const ChessGame& b) {
+    if (a.whiteToMove() != b.whiteToMove()) return false;
+    for (int r = 0; r < BOARD_SIZE; ++r)
+        for (int c = 0; c < BOARD_SIZE; ++c)
+            if (a.getPieceAt(r, c) != b.getPieceAt(r, c)) return false;
+    return true;
+}
+
+void writeBytes(const string& path, const string& bytes) {
+    ofstream out(path, ios::binary | ios::trunc);
+    out.write(bytes.data(), bytes.size());
+}
+
+string readBytes(const string& path) {
+    ifstream in(path, ios::binary);
+    return string(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+}
+
+void testRoundTrip(const string& path) {
+    remove(path.c_str());
+    string error;
+
+    // Game 1: standard start, ends in Scholar's mate
+    ChessGame scholar;
+    play(scholar, {"e2e4", "e7e5", "f1c4", "b8c6", "d1h5", "g8f6", "h5f7"});
+    CHECK(scholar.saveGame(path, RESULT_WHITE_WINS, error));
+
+    // Game 2: starts from a FEN, Black to move
+    const string fen = "6k1/5ppp/8/8/8/8/5PPP/R5K1 b - - 0 1";
+    ChessGame endgame;
+    CHECK(endgame.loadFEN(fen, error));
+    play(endgame, {"g8f8", "a1a8", "f8e7"});
+    CHECK(endgame.saveGame(path, RESULT_UNKNOWN, error));
+
+    // Game 3: no moves at all
+    ChessGame empty;
+    CHECK(empty.saveGame(path, RESULT_DRAW, error));
+
+    GameRecordReader reader;
+    CHECK(reader.open(path, error));
+    CHECK(reader.gameCount() == 3);
+    if (reader.gameCount() != 3) return;
+
+    GameView first = reader.game(0);
+    CHECK(first.startFen.empty());
+    CHECK(first.result == RESULT_WHITE_WINS);
+    CHECK(first.plyCount == 7);
+    ChessGame loaded;
+    CHECK(loaded.loadGame(first, error));
+    CHECK(samePosition(loaded, scholar));
+    CHECK(loaded.historySize() == 7);
+    CHECK(loaded.getLastMoveNotation() == scholar.getLastMoveNotation());
+
+    GameView second = reader.game(1);
+    CHECK(second.startFen == fen);
+    CHECK(second.plyCount == 3);
+    CHECK(loaded.loadGame(second, error));
+    CHECK(samePosition(loaded, endgame));
+    // Stepping back through a loaded game reaches its FEN start
+    while (loaded.undoMove()) {}
+    ChessGame start;
+    CHECK(start.loadFEN(fen, error));
+    CHECK(samePosition(loaded, start));
+
+    GameView third = reader.game(2);
+    CHECK(third.plyCount == 0);
+    CHECK(third.result == RESULT_DRAW);
+    CHECK(loaded.loadGame(third, error));
+    CHECK(samePosition(loaded, ChessGame()));
+}
+
+void testTruncatedFile(const string& path) {
+    string bytes = readBytes(path);
+    CHECK(bytes.size() > 8);
+    string error;
+
+    GameRecordReader reader;
+    CHECK(reader.open(path, error));
+    size_t games = reader.gameCount();
+    CHECK(games == 3);
+    CHECK(reader.partialTailBytes() == 0);
+    CHECK(reader.completeLength() == bytes.size());
+
+    // A torn append costs only the torn game: the ones before it still load
+    writeBytes(path, bytes.substr(0, bytes.size() - 1));
+    CHECK(reader.open(path, error));
+    CHECK(reader.gameCount() == games - 1);
+    CHECK(reader.partialTailBytes() > 0);
+    size_t lastGameStart = reader.completeLength();
+
+    // ...and the next append replaces it instead of landing behind it
+    ChessGame next;
+    play(next, {"d2d4", "d7d5"});
+    CHECK(next.saveGame(path, RESULT_DRAW, error));
+    CHECK(reader.open(path, error));
+    CHECK(reader.gameCount() == games);
+    CHECK(reader.partialTailBytes() == 0);
+    if (reader.gameCount() == games) {
+        GameView view = reader.game(games - 1);
+        CHECK(view.plyCount == 2 && view.result == RESULT_DRAW && view.startFen.empty());
+        ChessGame loaded;
+        CHECK(loaded.loadGame(view, error));
+        CHECK(samePosition(loaded, next));
+    }
+    CHECK(readBytes(path).substr(0, lastGameStart) == bytes.substr(0, lastGameStart));
+
+    // Cut into the first game's header: no games, all of it tail
+    writeBytes(path, bytes.substr(0, 4 + 3));
+    CHECK(reader.open(path, error));
+    CHECK(reader.gameCount() == 0);
+    CHECK(reader.partialTailBytes() == 3);
+
+    // Magic only: a valid file with no games
+    writeBytes(path, bytes.substr(0, 4));
+    CHECK(reader.open(path, error));
+    CHECK(reader.gameCount() == 0);
+}
+
+void testRejectsCorruptGames(const string& path) {
+    string error;
+    GameRecordReader reader;
+    // One whole game of one ply (e2e4 packs to 0x0934): header, then the move
+    string game = string("\x01\x00\x00\x00", 4) + char(RESULT_WHITE_WINS) + '\0' + "\x34\x09";
+    writeBytes(path, "CGR1" + game);
+    CHECK(reader.open(path, error));
+    CHECK(reader.gameCount() == 1);
+
+    string badResult = game;
+    badResult[4] = char(RESULT_DRAW + 1);
+    writeBytes(path, "CGR1" + game + badResult);
+    CHECK(!reader.open(path, error));
+    CHECK(error.find("game 2") != string::npos);
+
+    string badMove = game;
+    badMove[7] = char(badMove[7] | 0x10); // Bit 12
+    writeBytes(path, "CGR1" + badMove);
+    CHECK(!reader.open(path, error));
+
+    // Nothing is appended behind a damaged game either
+    ChessGame chess;
+    play(chess, {"e2e4"});
+    CHECK(!chess.saveGame(path, RESULT_UNKNOWN, error));
+    CHECK(readBytes(path) == "CGR1" + badMove);
+}
+
+void testRejectsForeignFiles(const string& path) {
+    string error;
+    ChessGame game;
+    play(game, {"e2e4"});
+
+    // Too short to hold the magic: neither readable nor appendable
+    writeBytes(path, "CG");
+    GameRecordReader reader;
+    CHECK(!reader.open(path, error));
+    CHECK(!game.saveGame(path, RESULT_UNKNOWN, error));
+    CHECK(readBytes(path) == "CG");
+
+    writeBytes(path, "not a record");
+    CHECK(!game.saveGame(path, RESULT_UNKNOWN, error));
+    CHECK(readBytes(path) == "not a record");
+}
+
+} // namespace
+
+int main() {
+    const string path = "game_record_test.cgr";
+    testRoundTrip(path);
+    testTruncatedFile(path);
+    testRejectsCorruptGames(path);
+    testRejectsForeignFiles(path);
+    remove(path.c_str());
+
+    if (failures) { cerr << failures << " check(s) failed" << endl; return 1; }
+    cout << "All game record checks passed" << endl;
+    return 0;
+}
@@ -0,0 +1,120 @@
+// Minimal UCI front-end so the engine can be driven by chess GUIs and
+// scripts. Supports: uci, isready, ucinewgame, setoption name MultiPV,
+// position [startpos | fen <fen>] [moves ...], go [depth N], quit.
+
+#include <algorithm> // For std::min, std::max
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Analysis.hpp"
+#include "ChessGame.hpp"
+#include "EngineStats.hpp"
+
+using namespace std;
+
+namespace {
+
+const int MAX_MULTI_PV = 64; // As advertised in the "uci" reply
+
+string moveToUci(const ChessGame& game, const Move& m) {
+    return game.indexToNotation(m.startR, m.startC) + game.indexToNotation(m.endR, m.endC);
+}
+
+// Applies one "e2e4" style move; returns false if it is malformed or illegal
+bool applyUciMove(ChessGame& game, const string& text) {
+    int startR, startC, endR, endC;
+    if (text.length() != 4 || !game.notationToIndex(text.substr(0, 2), startR, startC) ||
+        !game.notationToIndex(text.substr(2, 2), endR, endC)) return false;
+    if (!game.isMoveValid(startR, startC, endR, endC)) return false;
+    game.makeMove(startR, startC, endR, endC);
+    return true;
+}
+
+void handlePosition(istringstream& args, ChessGame& game) {
+    string token;
+    args >> token;
+    if (token == "startpos") {
+        game.initializeBoard();
+        args >> token; // "moves", if present
+    } else if (token == "fen") {
+        string fen, part;
+        while (args >> part && part != "moves") fen += (fen.empty() ? "" : " ") + part;
+        string error;
+        if (!game.loadFEN(fen, error)) { cout << "info string " << error << endl; return; }
+        token = part;
+    }
+    if (token != "moves") return;
+    while (args >> token) {
+        if (!applyUciMove(game, token)) { cout << "info string illegal move " << token << endl; return; }
+    }
+}
+
+void handleGo(istringstream& args, const ChessGame& game, AnalysisOptions options, TranspositionTable& tt) {
+    string token;
+    while (args >> token) {
+        if (token == "depth") args >> options.depth;
+    }
+
+    engineStats().reset();
+    vector<AnalysisLine> lines = analyzePosition(game, options, &tt);
+    for (size_t i = 0; i < lines.size(); ++i) {
+        const AnalysisLine& line = lines[i];
+        cout << "info depth " << options.depth << " multipv " << i + 1 << " score ";
+        if (line.score > MATE_SCORE - 1000) cout << "mate " << (MATE_SCORE - line.score + 1) / 2;
+        else if (line.score < -(MATE_SCORE - 1000)) cout << "mate -" << (MATE_SCORE + line.score + 1) / 2;
+        else cout << "cp " << line.score * 10; // Engine units are tenths of a pawn
+        cout << " pv";
+        for (const Move& m : line.pv) cout << " " << moveToUci(game, m);
+        cout << endl;
+    }
+#if CHESS_ENABLE_STATS
+    const EngineStats& s = engineStats();
+    cout << "info nodes " << s.nodes << endl;
+    cout << "info string qnodes " << s.qnodes << " tt_probes " << s.ttProbes << " tt_hits " << s.ttHits
+         << " tt_cutoffs " << s.ttCutoffs << " beta_cutoffs " << s.betaCutoffs
+         << " first_move_cutoff_rate " << s.firstMoveCutoffRate() << " branching_factor " << s.branchingFactor() << endl;
+#endif
+    cout << "bestmove " << (lines.empty() ? string("0000") : moveToUci(game, lines[0].move)) << endl;
+}
+
+} // namespace
+
+int main() {
+    ChessGame game;
+    AnalysisOptions options;
+    options.depth = 4;
+    TranspositionTable tt;
+
+    string line;
+    while (getline(cin, line)) {
+        istringstream args(line);
+        string command;
+        args >> command;
+
+        if (command == "uci") {
+            cout << "id name GAME-CHESS" << endl;
+            cout << "option name MultiPV type spin default 1 min 1 max " << MAX_MULTI_PV << endl;
+            cout << "uciok" << endl;
+        } else if (command == "isready") {
+            cout << "readyok" << endl;
+        } else if (command == "ucinewgame") {
+            game.initializeBoard();
+            tt.clear();
+        } else if (command == "setoption") {
+            string token, name, value;
+            args >> token >> name >> token >> value; // name <id> value <x>
+            int lines = 0;
+            istringstream number(value);
+            if (name == "MultiPV" && number >> lines) options.multiPV = min(MAX_MULTI_PV, max(1, lines));
+        } else if (command == "position") {
+            handlePosition(args, game);
+        } else if (command == "go") {
+            handleGo(args, game, options, tt);
+        } else if (command == "quit") {
+            break;
+        }
+    }
+    return 0;
+}